@@ -0,0 +1,2405 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class LimbVector {
+private:
+    static constexpr size_t inlineCapacity_ = 2;
+    unsigned long long *data_;
+    size_t size_;
+    size_t capacity_;
+    unsigned long long inline_[inlineCapacity_] = {};
+
+    bool isInline() const { return data_ == inline_; }
+
+    void reallocate(size_t capacity) {
+        unsigned long long *fresh = new unsigned long long[capacity];
+        std::copy(data_, data_ + size_, fresh);
+        if (!isInline()) delete[] data_;
+        data_ = fresh;
+        capacity_ = capacity;
+    }
+
+public:
+    LimbVector() : data_(inline_), size_(0), capacity_(inlineCapacity_) {}
+
+    explicit LimbVector(size_t size, unsigned long long value = 0) : LimbVector() {
+        assign(size, value);
+    }
+
+    LimbVector(const unsigned long long *first, const unsigned long long *last) : LimbVector() {
+        assign(first, last);
+    }
+
+    LimbVector(const LimbVector &argument) : LimbVector() {
+        assign(argument.begin(), argument.end());
+    }
+
+    LimbVector(LimbVector &&argument) noexcept: LimbVector() {
+        swap(argument);
+    }
+
+    LimbVector &operator=(const LimbVector &argument) {
+        if (this != &argument) assign(argument.begin(), argument.end());
+        return *this;
+    }
+
+    LimbVector &operator=(LimbVector &&argument) noexcept {
+        swap(argument);
+        return *this;
+    }
+
+    ~LimbVector() {
+        if (!isInline()) delete[] data_;
+    }
+
+    size_t size() const { return size_; }
+
+    unsigned long long *data() { return data_; }
+
+    const unsigned long long *data() const { return data_; }
+
+    unsigned long long *begin() { return data_; }
+
+    const unsigned long long *begin() const { return data_; }
+
+    unsigned long long *end() { return data_ + size_; }
+
+    const unsigned long long *end() const { return data_ + size_; }
+
+    unsigned long long &operator[](size_t index) { return data_[index]; }
+
+    const unsigned long long &operator[](size_t index) const { return data_[index]; }
+
+    unsigned long long &back() { return data_[size_ - 1]; }
+
+    const unsigned long long &back() const { return data_[size_ - 1]; }
+
+    void reserve(size_t capacity) {
+        if (capacity > capacity_) reallocate(std::max(capacity, 2 * capacity_));
+    }
+
+    void resize(size_t size, unsigned long long value = 0) {
+        reserve(size);
+        if (size > size_) std::fill(data_ + size_, data_ + size, value);
+        size_ = size;
+    }
+
+    void assign(size_t size, unsigned long long value) {
+        size_ = 0;
+        resize(size, value);
+    }
+
+    void assign(const unsigned long long *first, const unsigned long long *last) {
+        size_t size = last - first;
+        if (size > capacity_) {
+            LimbVector copy;
+            copy.reallocate(size);
+            std::copy(first, last, copy.data_);
+            copy.size_ = size;
+            swap(copy);
+            return;
+        }
+        std::copy(first, last, data_);
+        size_ = size;
+    }
+
+    void push_back(unsigned long long value) {
+        if (size_ == capacity_) reserve(size_ + 1);
+        data_[size_++] = value;
+    }
+
+    void pop_back() { --size_; }
+
+    void insert(unsigned long long *position, size_t count, unsigned long long value) {
+        size_t index = position - data_;
+        resize(size_ + count);
+        std::copy_backward(data_ + index, data_ + size_ - count, data_ + size_);
+        std::fill(data_ + index, data_ + index + count, value);
+    }
+
+    void erase(unsigned long long *first, unsigned long long *last) {
+        std::copy(last, end(), first);
+        size_ -= last - first;
+    }
+
+    void swap(LimbVector &argument) noexcept {
+        bool thisInline = isInline();
+        bool argumentInline = argument.isInline();
+        std::swap(inline_, argument.inline_);
+        std::swap(data_, argument.data_);
+        std::swap(size_, argument.size_);
+        std::swap(capacity_, argument.capacity_);
+        if (thisInline) argument.data_ = argument.inline_;
+        if (argumentInline) data_ = inline_;
+    }
+};
+
+class BigInteger {
+private:
+    static constexpr size_t maxNttLength_ = size_t(1) << 24;
+    static constexpr size_t decimalChunk_ = 19;
+    static constexpr unsigned long long decimalBase_ = 10000000000000000000ull;
+    LimbVector bigNumber_;
+    int sign_;
+
+    size_t length() const { return bigNumber_.size(); }
+
+    void addition(const BigInteger &argument) {
+        if (sign_ == 0) sign_ = argument.sign_;
+        if (bigNumber_.size() < argument.bigNumber_.size())
+            bigNumber_.resize(argument.bigNumber_.size());
+        bigNumber_.push_back(0);
+        addLimbs(bigNumber_.data(), bigNumber_.size(), argument.bigNumber_.data(), argument.length());
+        if (bigNumber_.back() == 0) bigNumber_.pop_back();
+    }
+
+    void subtraction(const BigInteger &argument) {
+        if (compare(argument) == false) {
+            subtractLimbs(bigNumber_.data(), length(), argument.bigNumber_.data(), argument.length());
+            removeLeadingZeros();
+        } else {
+            bigNumber_.resize(argument.bigNumber_.size(), 0);
+            if (sign_ == 0) sign_ = argument.sign_;
+            sign_ = -sign_;
+            unsigned long long borrow = 0;
+            for (size_t i = 0; i < bigNumber_.size(); ++i) {
+                unsigned long long minuend = argument.bigNumber_[i];
+                unsigned long long subtrahend = bigNumber_[i];
+                bigNumber_[i] = minuend - subtrahend - borrow;
+                borrow = minuend < subtrahend || (minuend == subtrahend && borrow);
+            }
+        }
+    }
+
+    void twoPart() {
+        for (size_t index = 0; index + 1 < bigNumber_.size(); ++index)
+            bigNumber_[index] = (bigNumber_[index] >> 1) | (bigNumber_[index + 1] << 63);
+        bigNumber_.back() >>= 1;
+        removeLeadingZeros();
+    }
+
+    void removeLeadingZeros() {
+        while (bigNumber_.size() > 1 && bigNumber_.back() == 0) bigNumber_.pop_back();
+        if (bigNumber_.size() == 1 && bigNumber_[0] == 0) sign_ = 0;
+    }
+
+    static BigInteger fromLimbs(const unsigned long long *limbs, size_t size) {
+        BigInteger result;
+        if (size == 0) return result;
+        result.bigNumber_.assign(limbs, limbs + size);
+        result.sign_ = 1;
+        result.removeLeadingZeros();
+        return result;
+    }
+
+    void shiftLimbs(size_t shift) {
+        if (sign_ == 0 || shift == 0) return;
+        bigNumber_.insert(bigNumber_.begin(), shift, 0);
+    }
+
+    unsigned long long divideBySmall(unsigned long long divisor) {
+        unsigned long long remainder = 0;
+        for (size_t i = bigNumber_.size(); i > 0; --i) {
+            unsigned __int128 current = ((unsigned __int128) remainder << 64) | bigNumber_[i - 1];
+            bigNumber_[i - 1] = (unsigned long long) (current / divisor);
+            remainder = (unsigned long long) (current % divisor);
+        }
+        removeLeadingZeros();
+        return remainder;
+    }
+
+    void multiplyAddSmall(unsigned long long factor, unsigned long long addend) {
+        unsigned __int128 carry = addend;
+        for (unsigned long long &limb: bigNumber_) {
+            carry += (unsigned __int128) limb * factor;
+            limb = (unsigned long long) carry;
+            carry >>= 64;
+        }
+        if (carry != 0) bigNumber_.push_back((unsigned long long) carry);
+    }
+
+    void shiftLeft(size_t bits) {
+        if (sign_ == 0 || bits == 0) return;
+        shiftLimbs(bits / 64);
+        bits %= 64;
+        if (bits == 0) return;
+        bigNumber_.push_back(0);
+        for (size_t i = bigNumber_.size() - 1; i > 0; --i)
+            bigNumber_[i] = (bigNumber_[i] << bits) | (bigNumber_[i - 1] >> (64 - bits));
+        bigNumber_[0] <<= bits;
+        removeLeadingZeros();
+    }
+
+    void shiftRight(size_t bits) {
+        if (sign_ == 0 || bits == 0) return;
+        size_t limbs = bits / 64;
+        bits %= 64;
+        if (limbs >= bigNumber_.size()) {
+            *this = 0;
+            return;
+        }
+        bigNumber_.erase(bigNumber_.begin(), bigNumber_.begin() + limbs);
+        if (bits != 0) {
+            for (size_t i = 0; i + 1 < bigNumber_.size(); ++i)
+                bigNumber_[i] = (bigNumber_[i] >> bits) | (bigNumber_[i + 1] << (64 - bits));
+            bigNumber_.back() >>= bits;
+        }
+        removeLeadingZeros();
+    }
+
+    size_t trailingZeros() const {
+        size_t limb = 0;
+        while (bigNumber_[limb] == 0) ++limb;
+        return 64 * limb + __builtin_ctzll(bigNumber_[limb]);
+    }
+
+    unsigned long long bitsFrom(size_t shift) const {
+        size_t limb = shift / 64;
+        size_t offset = shift % 64;
+        if (limb >= length()) return 0;
+        unsigned long long result = bigNumber_[limb] >> offset;
+        if (offset != 0 && limb + 1 < length()) result |= bigNumber_[limb + 1] << (64 - offset);
+        return result;
+    }
+
+    BigInteger lowBits(size_t bits) const {
+        if (bits >= bitLength()) return *this;
+        size_t limbs = (bits + 63) / 64;
+        BigInteger result = fromLimbs(bigNumber_.data(), limbs);
+        if (bits % 64 != 0 && result.length() == limbs) {
+            result.bigNumber_.back() &= (1ull << (bits % 64)) - 1;
+            result.removeLeadingZeros();
+        }
+        return result;
+    }
+
+    static void addLimbs(unsigned long long *target, size_t targetSize,
+                         const unsigned long long *source, size_t sourceSize) {
+        unsigned long long carry = 0;
+        size_t i = 0;
+        for (; i < sourceSize; ++i) {
+            unsigned long long sum = target[i] + carry;
+            carry = sum < carry;
+            target[i] = sum + source[i];
+            carry += target[i] < sum;
+        }
+        for (; carry != 0 && i < targetSize; ++i) {
+            target[i] += carry;
+            carry = target[i] == 0;
+        }
+    }
+
+    static void subtractLimbs(unsigned long long *target, size_t targetSize,
+                              const unsigned long long *source, size_t sourceSize) {
+        unsigned long long borrow = 0;
+        size_t i = 0;
+        for (; i < sourceSize; ++i) {
+            unsigned long long minuend = target[i];
+            target[i] = minuend - source[i] - borrow;
+            borrow = minuend < source[i] || (minuend == source[i] && borrow);
+        }
+        for (; borrow != 0 && i < targetSize; ++i) {
+            borrow = target[i] == 0;
+            --target[i];
+        }
+    }
+
+    static unsigned long long addMultipleLimbs(unsigned long long *target, const unsigned long long *source,
+                                               size_t size, unsigned long long factor) {
+        unsigned long long carry = 0;
+        for (size_t i = 0; i < size; ++i) {
+            unsigned __int128 current = (unsigned __int128) source[i] * factor + target[i] + carry;
+            target[i] = (unsigned long long) current;
+            carry = (unsigned long long) (current >> 64);
+        }
+        return carry;
+    }
+
+    static unsigned long long subtractMultipleLimbs(unsigned long long *target, const unsigned long long *source,
+                                                    size_t size, unsigned long long factor) {
+        unsigned long long borrow = 0;
+        for (size_t i = 0; i < size; ++i) {
+            unsigned __int128 current = (unsigned __int128) source[i] * factor + borrow;
+            unsigned long long low = (unsigned long long) current;
+            borrow = (unsigned long long) (current >> 64) + (target[i] < low);
+            target[i] -= low;
+        }
+        return borrow;
+    }
+
+    static void combineLimbs(const unsigned long long *lhs, size_t lhsSize, long long lhsFactor,
+                             const unsigned long long *rhs, size_t rhsSize, long long rhsFactor,
+                             unsigned long long *result, size_t size) {
+        __int128 carry = 0;
+        for (size_t i = 0; i < size; ++i) {
+            __int128 current = carry;
+            if (i < lhsSize) current += (__int128) lhsFactor * lhs[i];
+            if (i < rhsSize) current += (__int128) rhsFactor * rhs[i];
+            result[i] = (unsigned long long) current;
+            carry = current >> 64;
+        }
+    }
+
+    static unsigned long long binaryGcd(unsigned long long lhs, unsigned long long rhs) {
+        if (lhs == 0) return rhs;
+        if (rhs == 0) return lhs;
+        int shift = __builtin_ctzll(lhs | rhs);
+        lhs >>= __builtin_ctzll(lhs);
+        while (rhs != 0) {
+            rhs >>= __builtin_ctzll(rhs);
+            if (lhs > rhs) std::swap(lhs, rhs);
+            rhs -= lhs;
+        }
+        return lhs << shift;
+    }
+
+    static size_t significantLimbs(const unsigned long long *limbs, size_t size) {
+        while (size > 0 && limbs[size - 1] == 0) --size;
+        return size;
+    }
+
+    static void schoolbookMultiply(const unsigned long long *lhs, size_t lhsSize,
+                                   const unsigned long long *rhs, size_t rhsSize,
+                                   unsigned long long *result) {
+        std::fill(result, result + lhsSize + rhsSize, 0);
+        for (size_t i = 0; i < lhsSize; ++i) {
+            unsigned long long carry = 0;
+            for (size_t k = 0; k < rhsSize; ++k) {
+                unsigned __int128 current =
+                        (unsigned __int128) lhs[i] * rhs[k] + result[i + k] + carry;
+                result[i + k] = (unsigned long long) current;
+                carry = (unsigned long long) (current >> 64);
+            }
+            result[i + rhsSize] = carry;
+        }
+    }
+
+    static void karatsubaMultiply(const unsigned long long *lhs, const unsigned long long *rhs, size_t size,
+                                  unsigned long long *result) {
+        if (size < std::max<size_t>(karatsubaThreshold, 4)) {
+            schoolbookMultiply(lhs, size, rhs, size, result);
+            return;
+        }
+        size_t low = size / 2;
+        size_t high = size - low;
+        karatsubaMultiply(lhs, rhs, low, result);
+        karatsubaMultiply(lhs + low, rhs + low, high, result + 2 * low);
+
+        std::vector<unsigned long long> lhsSum(lhs + low, lhs + size);
+        std::vector<unsigned long long> rhsSum(rhs + low, rhs + size);
+        lhsSum.push_back(0);
+        rhsSum.push_back(0);
+        addLimbs(lhsSum.data(), high + 1, lhs, low);
+        addLimbs(rhsSum.data(), high + 1, rhs, low);
+        std::vector<unsigned long long> middle(2 * high + 2);
+        karatsubaMultiply(lhsSum.data(), rhsSum.data(), high + 1, middle.data());
+        subtractLimbs(middle.data(), middle.size(), result, 2 * low);
+        subtractLimbs(middle.data(), middle.size(), result + 2 * low, 2 * high);
+        addLimbs(result + low, 2 * size - low, middle.data(),
+                 significantLimbs(middle.data(), middle.size()));
+    }
+
+    static unsigned long long powerOfTen(size_t exponent) {
+        unsigned long long result = 1;
+        while (exponent-- > 0) result *= 10;
+        return result;
+    }
+
+    static unsigned long long powerMod(unsigned long long base, unsigned long long exponent,
+                                       unsigned long long mod) {
+        unsigned long long result = 1;
+        base %= mod;
+        while (exponent != 0) {
+            if (exponent & 1) result = result * base % mod;
+            base = base * base % mod;
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    template<unsigned long long Mod, unsigned long long Root>
+    static void numberTheoreticTransform(std::vector<unsigned long long> &data, bool inverse) {
+        size_t size = data.size();
+        for (size_t i = 1, k = 0; i < size; ++i) {
+            size_t bit = size >> 1;
+            for (; k & bit; bit >>= 1) k ^= bit;
+            k ^= bit;
+            if (i < k) std::swap(data[i], data[k]);
+        }
+        std::vector<unsigned long long> roots(size / 2 + 1);
+        for (size_t length = 2; length <= size; length <<= 1) {
+            size_t half = length / 2;
+            unsigned long long step = powerMod(Root, (Mod - 1) / length, Mod);
+            if (inverse) step = powerMod(step, Mod - 2, Mod);
+            roots[0] = 1;
+            for (size_t j = 1; j < half; ++j) roots[j] = roots[j - 1] * step % Mod;
+            for (size_t start = 0; start < size; start += length) {
+                for (size_t j = 0; j < half; ++j) {
+                    unsigned long long u = data[start + j];
+                    unsigned long long v = data[start + j + half] * roots[j] % Mod;
+                    data[start + j] = u + v < Mod ? u + v : u + v - Mod;
+                    data[start + j + half] = u >= v ? u - v : u + Mod - v;
+                }
+            }
+        }
+        if (inverse) {
+            unsigned long long scale = powerMod(size, Mod - 2, Mod);
+            for (unsigned long long &value: data) value = value * scale % Mod;
+        }
+    }
+
+    template<unsigned long long Mod, unsigned long long Root>
+    static void nttLoad(std::vector<unsigned long long> &target, const unsigned long long *limbs,
+                        size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            target[2 * i] = (limbs[i] & 0xffffffffull) % Mod;
+            target[2 * i + 1] = (limbs[i] >> 32) % Mod;
+        }
+        numberTheoreticTransform<Mod, Root>(target, false);
+    }
+
+    template<unsigned long long Mod, unsigned long long Root>
+    static std::vector<unsigned long long> nttConvolve(const unsigned long long *lhs, size_t lhsSize,
+                                                       const unsigned long long *rhs, size_t rhsSize,
+                                                       size_t size, bool square) {
+        std::vector<unsigned long long> first(size, 0);
+        nttLoad<Mod, Root>(first, lhs, lhsSize);
+        if (square) {
+            for (unsigned long long &value: first) value = value * value % Mod;
+        } else {
+            std::vector<unsigned long long> second(size, 0);
+            nttLoad<Mod, Root>(second, rhs, rhsSize);
+            for (size_t i = 0; i < size; ++i) first[i] = first[i] * second[i] % Mod;
+        }
+        numberTheoreticTransform<Mod, Root>(first, true);
+        return first;
+    }
+
+    static void nttMultiply(const unsigned long long *lhs, size_t lhsSize,
+                            const unsigned long long *rhs, size_t rhsSize,
+                            unsigned long long *result) {
+        const unsigned long long mod0 = 2013265921, mod1 = 1811939329, mod2 = 2113929217;
+        bool square = lhsSize == rhsSize && std::equal(lhs, lhs + lhsSize, rhs);
+        size_t size = 1;
+        while (size < 2 * (lhsSize + rhsSize)) size <<= 1;
+        std::vector<unsigned long long> residue0 =
+                nttConvolve<mod0, 31>(lhs, lhsSize, rhs, rhsSize, size, square);
+        std::vector<unsigned long long> residue1 =
+                nttConvolve<mod1, 13>(lhs, lhsSize, rhs, rhsSize, size, square);
+        std::vector<unsigned long long> residue2 =
+                nttConvolve<mod2, 5>(lhs, lhsSize, rhs, rhsSize, size, square);
+
+        unsigned long long inverse01 = powerMod(mod0, mod1 - 2, mod1);
+        unsigned long long inverse012 = powerMod(mod0 * mod1 % mod2, mod2 - 2, mod2);
+        unsigned __int128 carry = 0;
+        for (size_t i = 0; i < 2 * (lhsSize + rhsSize); ++i) {
+            unsigned long long x0 = residue0[i];
+            unsigned long long x1 = (residue1[i] + mod1 - x0 % mod1) % mod1 * inverse01 % mod1;
+            unsigned long long x2 = (residue2[i] + mod2 - (x0 + x1 * mod0) % mod2) % mod2 *
+                                    inverse012 % mod2;
+            carry += x0 + (unsigned __int128) x1 * mod0 + (unsigned __int128) x2 * mod0 * mod1;
+            unsigned long long half = (unsigned long long) carry & 0xffffffffull;
+            if (i % 2 == 0)
+                result[i / 2] = half;
+            else
+                result[i / 2] |= half << 32;
+            carry >>= 32;
+        }
+    }
+
+    static const BigInteger &decimalPower(size_t level) {
+        // Per thread, so concurrent printing never races on the lazy growth below.
+        static thread_local std::deque<BigInteger> powers;
+        if (powers.empty()) powers.push_back(fromLimbs(&decimalBase_, 1));
+        while (powers.size() <= level) {
+            powers.push_back(powers.back());
+            powers.back() *= powers[powers.size() - 2];
+        }
+        return powers[level];
+    }
+
+    static void writeDecimal(const BigInteger &value, char *end, size_t width) {
+        if (value.length() <= radixConversionThreshold) {
+            LimbVector rest(value.bigNumber_);
+            size_t size = value.sign_ == 0 ? 0 : rest.size();
+            while (width > 0) {
+                unsigned long long chunk = 0;
+                for (size_t i = size; i > 0; --i) {
+                    unsigned __int128 current = ((unsigned __int128) chunk << 64) | rest[i - 1];
+                    rest[i - 1] = (unsigned long long) (current / decimalBase_);
+                    chunk = (unsigned long long) (current % decimalBase_);
+                }
+                while (size > 0 && rest[size - 1] == 0) --size;
+                for (size_t i = 0; i < decimalChunk_ && width > 0; ++i, --width) {
+                    *--end = char('0' + chunk % 10);
+                    chunk /= 10;
+                }
+            }
+            return;
+        }
+        size_t level = 0;
+        while (decimalChunk_ << (level + 1) < width) ++level;
+        size_t lowWidth = decimalChunk_ << level;
+        std::pair<BigInteger, BigInteger> parts = divmod(value, decimalPower(level));
+        writeDecimal(parts.second, end, lowWidth);
+        writeDecimal(parts.first, end - lowWidth, width - lowWidth);
+    }
+
+    static size_t decimalWidth(const BigInteger &value) {
+        return value.sign_ == 0 ? 1 : value.bitLength() * 30103 / 100000 + 1;
+    }
+
+    template <typename Sink>
+    static void streamDecimal(const BigInteger &value, size_t width, Sink &sink) {
+        static const std::string zeroes(256, '0');
+        for (size_t digits = decimalWidth(value); width > digits;) {
+            size_t count = std::min(width - digits, zeroes.size());
+            sink(zeroes.data(), count);
+            width -= count;
+        }
+        if (value.length() <= radixConversionThreshold) {
+            std::string buffer(width, '0');
+            writeDecimal(value, &buffer[0] + width, width);
+            sink(buffer.data(), width);
+            return;
+        }
+        size_t level = 0;
+        while (decimalChunk_ << (level + 1) < width) ++level;
+        size_t lowWidth = decimalChunk_ << level;
+        std::pair<BigInteger, BigInteger> parts = divmod(value, decimalPower(level));
+        streamDecimal(parts.first, width - lowWidth, sink);
+        streamDecimal(parts.second, lowWidth, sink);
+    }
+
+    static BigInteger decimalScale(size_t exponent) {
+        unsigned long long low = powerOfTen(exponent % decimalChunk_);
+        BigInteger result = fromLimbs(&low, 1);
+        exponent /= decimalChunk_;
+        for (size_t level = 0; exponent != 0; ++level, exponent >>= 1)
+            if (exponent & 1) result *= decimalPower(level);
+        return result;
+    }
+
+    static BigInteger parseDecimal(const char *digits, size_t count) {
+        if (count <= decimalChunk_ * radixConversionThreshold) {
+            BigInteger result;
+            result.sign_ = 1;
+            size_t chunk = count % decimalChunk_;
+            if (chunk == 0) chunk = decimalChunk_;
+            for (size_t position = 0; position < count; position += chunk) {
+                if (position != 0) chunk = decimalChunk_;
+                unsigned long long value = 0;
+                for (size_t i = position; i < position + chunk; ++i) value = value * 10 + (digits[i] - '0');
+                result.multiplyAddSmall(position == 0 ? powerOfTen(chunk) : decimalBase_, value);
+            }
+            result.removeLeadingZeros();
+            return result;
+        }
+        size_t level = 0;
+        while (decimalChunk_ << (level + 1) < count) ++level;
+        size_t lowCount = decimalChunk_ << level;
+        BigInteger result = parseDecimal(digits, count - lowCount);
+        result *= decimalPower(level);
+        result += parseDecimal(digits + count - lowCount, lowCount);
+        return result;
+    }
+
+    static void toomMultiply(const unsigned long long *lhs, const unsigned long long *rhs, size_t size,
+                             unsigned long long *result);
+
+    void accumulateProduct(const BigInteger &lhs, const BigInteger &rhs, int productSign);
+
+    static bool lehmerMatrix(const BigInteger &lhs, const BigInteger &rhs, long long (&matrix)[2][2]);
+
+    static void applyLehmerMatrix(BigInteger &lhs, BigInteger &rhs, const long long (&matrix)[2][2]);
+
+    static void applyLehmerCofactors(BigInteger &lhs, BigInteger &rhs, const long long (&matrix)[2][2]);
+
+    static void euclidStep(BigInteger &lhs, BigInteger &rhs, BigInteger *lhsFactor, BigInteger *rhsFactor);
+
+    static void reducedSteps(BigInteger &lhs, BigInteger &rhs, size_t bits, BigInteger (&matrix)[2][2]);
+
+    static void liftHalfGcd(BigInteger &lhs, BigInteger &rhs, size_t split, BigInteger (&matrix)[2][2]);
+
+    static void halfGcd(BigInteger &lhs, BigInteger &rhs, BigInteger (&matrix)[2][2]);
+
+    static BigInteger limbRange(const BigInteger &argument, size_t from, size_t count);
+
+    static void schoolbookDivide(const BigInteger &dividend, const BigInteger &divisor,
+                                 BigInteger &quotient, BigInteger &remainder);
+
+    static void divideThreeByTwo(const BigInteger &dividend, const BigInteger &divisor,
+                                 size_t half, BigInteger &quotient, BigInteger &remainder);
+
+    static void divideTwoByOne(const BigInteger &dividend, const BigInteger &divisor,
+                               size_t size, BigInteger &quotient, BigInteger &remainder);
+
+    static void burnikelZieglerDivide(const BigInteger &dividend, const BigInteger &divisor,
+                                      BigInteger &quotient, BigInteger &remainder);
+
+    static void multiplyLimbs(const unsigned long long *lhs, size_t lhsSize,
+                              const unsigned long long *rhs, size_t rhsSize, unsigned long long *result) {
+        if (lhsSize < rhsSize) {
+            std::swap(lhs, rhs);
+            std::swap(lhsSize, rhsSize);
+        }
+        if (rhsSize < karatsubaThreshold) {
+            schoolbookMultiply(lhs, lhsSize, rhs, rhsSize, result);
+            return;
+        }
+        if (rhsSize >= nttThreshold && lhsSize + rhsSize <= maxNttLength_) {
+            nttMultiply(lhs, lhsSize, rhs, rhsSize, result);
+            return;
+        }
+        if (lhsSize >= 2 * rhsSize) {
+            std::fill(result, result + lhsSize + rhsSize, 0);
+            std::vector<unsigned long long> product(2 * rhsSize);
+            for (size_t offset = 0; offset < lhsSize; offset += rhsSize) {
+                size_t chunk = std::min(rhsSize, lhsSize - offset);
+                multiplyLimbs(lhs + offset, chunk, rhs, rhsSize, product.data());
+                addLimbs(result + offset, lhsSize + rhsSize - offset, product.data(), chunk + rhsSize);
+            }
+            return;
+        }
+        std::vector<unsigned long long> padded;
+        if (rhsSize < lhsSize) {
+            padded.assign(rhs, rhs + rhsSize);
+            padded.resize(lhsSize, 0);
+            rhs = padded.data();
+        }
+        std::vector<unsigned long long> product;
+        unsigned long long *target = result;
+        if (rhsSize < lhsSize) {
+            product.resize(2 * lhsSize);
+            target = product.data();
+        }
+        if (lhsSize >= std::max<size_t>(toomThreshold, 9))
+            toomMultiply(lhs, rhs, lhsSize, target);
+        else
+            karatsubaMultiply(lhs, rhs, lhsSize, target);
+        if (target != result) std::copy(product.begin(), product.begin() + lhsSize + rhsSize, result);
+    }
+
+    static void squareLimbs(const unsigned long long *limbs, size_t size, unsigned long long *result) {
+        if (size >= karatsubaThreshold) {
+            multiplyLimbs(limbs, size, limbs, size, result);
+            return;
+        }
+        std::fill(result, result + 2 * size, 0);
+        for (size_t i = 0; i + 1 < size; ++i)
+            result[i + size] = addMultipleLimbs(result + 2 * i + 1, limbs + i + 1, size - i - 1, limbs[i]);
+        unsigned long long carry = 0;
+        for (size_t i = 0; i < 2 * size; ++i) {
+            unsigned long long next = result[i] >> 63;
+            result[i] = (result[i] << 1) | carry;
+            carry = next;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            unsigned __int128 low = (unsigned __int128) limbs[i] * limbs[i] + result[2 * i] + carry;
+            unsigned __int128 high = (low >> 64) + result[2 * i + 1];
+            result[2 * i] = (unsigned long long) low;
+            result[2 * i + 1] = (unsigned long long) high;
+            carry = (unsigned long long) (high >> 64);
+        }
+    }
+
+    static unsigned long long montgomeryInverse(unsigned long long modulus) {
+        unsigned long long inverse = modulus;
+        for (int i = 0; i < 5; ++i) inverse *= 2 - modulus * inverse;
+        return -inverse;
+    }
+
+    static void montgomeryMultiply(const unsigned long long *lhs, const unsigned long long *rhs,
+                                   const unsigned long long *modulus, size_t size, unsigned long long inverse,
+                                   unsigned long long *scratch, unsigned long long *result) {
+        std::fill(scratch, scratch + size + 2, 0);
+        for (size_t i = 0; i < size; ++i) {
+            unsigned __int128 current = (unsigned __int128) scratch[size] + addMultipleLimbs(scratch, lhs, size, rhs[i]);
+            scratch[size] = (unsigned long long) current;
+            scratch[size + 1] = (unsigned long long) (current >> 64);
+            unsigned long long factor = scratch[0] * inverse;
+            current = (unsigned __int128) modulus[0] * factor + scratch[0];
+            for (size_t k = 1; k < size; ++k) {
+                current = (unsigned __int128) modulus[k] * factor + scratch[k] + (unsigned long long) (current >> 64);
+                scratch[k - 1] = (unsigned long long) current;
+            }
+            current = (unsigned __int128) scratch[size] + (unsigned long long) (current >> 64);
+            scratch[size - 1] = (unsigned long long) current;
+            scratch[size] = scratch[size + 1] + (unsigned long long) (current >> 64);
+        }
+        size_t index = size;
+        if (scratch[size] == 0)
+            while (index > 0 && scratch[index - 1] == modulus[index - 1]) --index;
+        if (scratch[size] != 0 || index == 0 || scratch[index - 1] > modulus[index - 1])
+            subtractLimbs(scratch, size + 1, modulus, size);
+        std::copy(scratch, scratch + size, result);
+    }
+
+    static size_t windowBits(size_t exponentBits) {
+        size_t window = 1;
+        for (size_t bound : {8, 24, 80, 240, 672})
+            if (exponentBits > bound) ++window;
+        return window;
+    }
+
+    template <typename Square, typename Multiply>
+    static void slidingWindow(const BigInteger &exponent, size_t window, Square square, Multiply multiply) {
+        size_t bit = exponent.sign_ == 0 ? 0 : exponent.bitLength();
+        bool started = false;
+        while (bit > 0) {
+            if ((exponent.bitsFrom(bit - 1) & 1) == 0) {
+                square();
+                --bit;
+                continue;
+            }
+            size_t low = bit > window ? bit - window : 0;
+            while ((exponent.bitsFrom(low) & 1) == 0) ++low;
+            if (started)
+                for (size_t i = low; i < bit; ++i) square();
+            multiply(size_t((exponent.bitsFrom(low) & ((1ull << (bit - low)) - 1)) >> 1));
+            started = true;
+            bit = low;
+        }
+    }
+
+    static void knuthDivide(const unsigned long long *dividend, size_t dividendSize,
+                            const unsigned long long *divisor, size_t divisorSize,
+                            unsigned long long *quotient, unsigned long long *remainder) {
+        int bits = __builtin_clzll(divisor[divisorSize - 1]);
+        std::vector<unsigned long long> u(dividendSize + 1, 0);
+        std::vector<unsigned long long> v(divisorSize, 0);
+        for (size_t i = dividendSize; i > 0; --i) {
+            u[i] |= bits ? dividend[i - 1] >> (64 - bits) : 0;
+            u[i - 1] = dividend[i - 1] << bits;
+        }
+        for (size_t i = divisorSize; i > 0; --i) {
+            if (i < divisorSize && bits) v[i] |= divisor[i - 1] >> (64 - bits);
+            v[i - 1] = divisor[i - 1] << bits;
+        }
+
+        unsigned long long top = v[divisorSize - 1];
+        unsigned long long second = v[divisorSize - 2];
+        for (size_t j = dividendSize - divisorSize + 1; j > 0; --j) {
+            size_t shift = j - 1;
+            unsigned __int128 head =
+                    ((unsigned __int128) u[shift + divisorSize] << 64) | u[shift + divisorSize - 1];
+            unsigned __int128 estimate = head / top;
+            unsigned __int128 rest = head % top;
+            while ((estimate >> 64) != 0 ||
+                   estimate * second > ((rest << 64) | u[shift + divisorSize - 2])) {
+                --estimate;
+                rest += top;
+                if ((rest >> 64) != 0) break;
+            }
+
+            unsigned long long borrow = 0;
+            unsigned long long carry = 0;
+            for (size_t i = 0; i < divisorSize; ++i) {
+                unsigned __int128 product = estimate * v[i] + carry;
+                carry = (unsigned long long) (product >> 64);
+                unsigned long long low = (unsigned long long) product;
+                unsigned long long minuend = u[shift + i];
+                u[shift + i] = minuend - low - borrow;
+                borrow = minuend < low || (minuend == low && borrow);
+            }
+            unsigned long long minuend = u[shift + divisorSize];
+            u[shift + divisorSize] = minuend - carry - borrow;
+            if (minuend < carry || (minuend == carry && borrow)) {
+                --estimate;
+                addLimbs(u.data() + shift, divisorSize + 1, v.data(), divisorSize);
+            }
+            quotient[shift] = (unsigned long long) estimate;
+        }
+
+        for (size_t i = 0; i < divisorSize; ++i) {
+            remainder[i] = u[i] >> bits;
+            if (bits) remainder[i] |= u[i + 1] << (64 - bits);
+        }
+    }
+
+
+public:
+    static inline size_t karatsubaThreshold = 32;
+    static inline size_t toomThreshold = 128;
+    static inline size_t nttThreshold = 4096;
+    static inline size_t burnikelZieglerThreshold = 80;
+    static inline size_t radixConversionThreshold = 32;
+    static inline size_t halfGcdThreshold = 128;
+
+    BigInteger(long long x) {
+        if (x == 0) {
+            sign_ = 0;
+            bigNumber_.push_back(0);
+            return;
+        }
+        sign_ = x < 0 ? -1 : 1;
+        bigNumber_.push_back(x < 0 ? 0ull - (unsigned long long) x : (unsigned long long) x);
+    }
+
+    BigInteger() : BigInteger(0ll) {}
+
+    BigInteger(const std::string &stringInput) : BigInteger() {
+        size_t start = stringInput[0] == '-' ? 1 : 0;
+        *this = parseDecimal(stringInput.data() + start, stringInput.length() - start);
+        if (start == 1) sign_ = -sign_;
+    }
+
+    int BigIntegerSign() const { return sign_; }
+
+    size_t bitLength() const {
+        if (sign_ == 0) return 0;
+        return 64 * length() - __builtin_clzll(bigNumber_.back());
+    }
+
+    BigInteger(const BigInteger &argument) = default;
+
+    BigInteger(BigInteger &&argument) noexcept: bigNumber_(std::move(argument.bigNumber_)), sign_(argument.sign_) {
+        argument.bigNumber_.assign(1, 0);
+        argument.sign_ = 0;
+    }
+
+    void swap(BigInteger &argument) noexcept {
+        bigNumber_.swap(argument.bigNumber_);
+        std::swap(sign_, argument.sign_);
+    }
+
+    BigInteger &operator=(const BigInteger &argument) {
+        bigNumber_ = argument.bigNumber_;
+        sign_ = argument.sign_;
+        return *this;
+    }
+
+    BigInteger &operator=(BigInteger &&argument) noexcept {
+        swap(argument);
+        return *this;
+    }
+
+    void invert() {
+        sign_ *= -1;
+    }
+
+    const std::string toString() const {
+        std::string result;
+        appendTo(result);
+        return result;
+    }
+
+    void appendTo(std::string &buffer) const {
+        if (sign_ == 0) {
+            buffer.push_back('0');
+            return;
+        }
+        if (sign_ == -1) buffer.push_back('-');
+        size_t width = decimalWidth(*this);
+        size_t start = buffer.size();
+        buffer.resize(start + width);
+        writeDecimal(*this, &buffer[0] + start + width, width);
+        size_t zeroes = 0;
+        while (zeroes + 1 < width && buffer[start + zeroes] == '0') ++zeroes;
+        buffer.erase(start, zeroes);
+    }
+
+    bool compare(const BigInteger &argument) const {
+        if (length() < argument.length()) return true;
+        if (length() > argument.length()) return false;
+        for (size_t i = length(); i > 0; --i) {
+            if (bigNumber_[i - 1] < argument.bigNumber_[i - 1]) return true;
+            if (bigNumber_[i - 1] > argument.bigNumber_[i - 1]) return false;
+        }
+        return false;
+    }
+
+    explicit operator bool() const { return sign_; }
+
+    BigInteger &operator+=(const BigInteger &argument);
+
+    BigInteger &operator-=(const BigInteger &argument);
+
+    BigInteger &operator*=(const BigInteger &argument);
+
+    BigInteger &operator/=(const BigInteger &argument);
+
+    BigInteger &operator%=(const BigInteger &argument);
+
+    BigInteger &divideExact(const BigInteger &argument);
+
+    unsigned long long residue(unsigned long long modulus) const {
+        unsigned long long remainder = 0;
+        for (size_t i = length(); i > 0; --i)
+            remainder = (unsigned long long) ((((unsigned __int128) remainder << 64) | bigNumber_[i - 1]) % modulus);
+        return sign_ < 0 && remainder != 0 ? modulus - remainder : remainder;
+    }
+
+    BigInteger &addMul(const BigInteger &lhs, const BigInteger &rhs) {
+        accumulateProduct(lhs, rhs, lhs.sign_ * rhs.sign_);
+        return *this;
+    }
+
+    BigInteger &subMul(const BigInteger &lhs, const BigInteger &rhs) {
+        accumulateProduct(lhs, rhs, -lhs.sign_ * rhs.sign_);
+        return *this;
+    }
+
+    static BigInteger mulAdd(const BigInteger &lhs, const BigInteger &rhs, const BigInteger &addend) {
+        BigInteger result(addend);
+        result.addMul(lhs, rhs);
+        return result;
+    }
+
+    static void reduction(BigInteger &num, BigInteger &den);
+
+    static BigInteger gcd(const BigInteger &lhs, const BigInteger &rhs);
+
+    static BigInteger extendedGcd(const BigInteger &lhs, const BigInteger &rhs,
+                                  BigInteger &lhsFactor, BigInteger &rhsFactor);
+
+    static void divide(const BigInteger &dividend, const BigInteger &divisor,
+                       BigInteger &quotient, BigInteger &remainder);
+
+    static std::pair<BigInteger, BigInteger> divmod(const BigInteger &dividend,
+                                                    const BigInteger &divisor);
+
+    static BigInteger pow(const BigInteger &base, unsigned long long exponent);
+
+    static BigInteger powmod(const BigInteger &base, const BigInteger &exponent, const BigInteger &modulus);
+
+    static BigInteger iroot(const BigInteger &argument, unsigned long long degree);
+
+    static BigInteger isqrt(const BigInteger &argument) { return iroot(argument, 2); }
+
+
+    BigInteger operator-() const &{
+        BigInteger newBigInteger(*this);
+        newBigInteger.sign_ = -sign_;
+        return newBigInteger;
+    }
+
+    BigInteger operator-() &&{
+        sign_ = -sign_;
+        return std::move(*this);
+    }
+
+    BigInteger &operator++() {
+        *this += 1;
+        return *this;
+    }
+
+    BigInteger operator++(int) {
+        BigInteger newBigInteger = *this;
+        ++(*this);
+        return newBigInteger;
+    }
+
+    BigInteger &operator--() {
+        *this -= 1;
+        return *this;
+    }
+
+    BigInteger operator--(int) {
+        BigInteger newBigInteger = *this;
+        --(*this);
+        return newBigInteger;
+    }
+
+    friend std::ostream &operator<<(std::ostream &Ostream,
+                                    const BigInteger &argument);
+
+    friend class Rational;
+};
+
+inline std::istream &operator>>(std::istream &Istream, BigInteger &argument) {
+    std::string inputString;
+    Istream >> inputString;
+    argument = BigInteger(inputString);
+    return Istream;
+}
+
+inline std::ostream &operator<<(std::ostream &Ostream, const BigInteger &argument) {
+    static thread_local std::string buffer;
+    buffer.clear();
+    argument.appendTo(buffer);
+    Ostream << buffer;
+    return Ostream;
+}
+
+inline BigInteger operator+(const BigInteger &lhs, const BigInteger &rhs) {
+    BigInteger newBigInteger(lhs);
+    newBigInteger += rhs;
+    return newBigInteger;
+}
+
+inline BigInteger operator+(BigInteger &&lhs, const BigInteger &rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+inline BigInteger operator+(const BigInteger &lhs, BigInteger &&rhs) {
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+inline BigInteger operator+(BigInteger &&lhs, BigInteger &&rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+inline BigInteger operator-(const BigInteger &lhs, const BigInteger &rhs) {
+    BigInteger newBigInteger(lhs);
+    newBigInteger -= rhs;
+    return newBigInteger;
+}
+
+inline BigInteger operator-(BigInteger &&lhs, const BigInteger &rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+inline BigInteger operator-(const BigInteger &lhs, BigInteger &&rhs) {
+    rhs -= lhs;
+    rhs.invert();
+    return std::move(rhs);
+}
+
+inline BigInteger operator-(BigInteger &&lhs, BigInteger &&rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+inline BigInteger operator*(const BigInteger &lhs, const BigInteger &rhs) {
+    BigInteger newBigInteger(lhs);
+    newBigInteger *= rhs;
+    return newBigInteger;
+}
+
+inline BigInteger operator*(BigInteger &&lhs, const BigInteger &rhs) {
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+inline BigInteger operator*(const BigInteger &lhs, BigInteger &&rhs) {
+    rhs *= lhs;
+    return std::move(rhs);
+}
+
+inline BigInteger operator*(BigInteger &&lhs, BigInteger &&rhs) {
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+inline bool operator<(const BigInteger &lhs, const BigInteger &rhs) {
+    if (lhs.BigIntegerSign() < rhs.BigIntegerSign()) return true;
+    if (lhs.BigIntegerSign() > rhs.BigIntegerSign()) return false;
+    if (lhs.BigIntegerSign() == 0) return false;
+    if (lhs.BigIntegerSign() < 0) {
+        return rhs.compare(lhs);
+    }
+    return lhs.compare(rhs);
+}
+
+inline bool operator>(const BigInteger &lhs, const BigInteger &rhs) {
+    return rhs < lhs;
+}
+
+inline bool operator==(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(lhs < rhs) && !(lhs > rhs);
+}
+
+inline bool operator<=(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(lhs > rhs);
+}
+
+inline bool operator>=(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(lhs < rhs);
+}
+
+inline bool operator!=(const BigInteger &lhs, const BigInteger &rhs) {
+    return !(lhs == rhs);
+}
+
+inline BigInteger &BigInteger::operator+=(const BigInteger &argument) {
+    if (this == &argument) {
+        BigInteger copy = argument;
+        return *this += copy;
+    }
+    if (sign_ * argument.sign_ >= 0)
+        addition(argument);
+    else {
+        subtraction(argument);
+        size_t i = bigNumber_.size() - 1;
+        while (bigNumber_[i] == 0 && bigNumber_.size() > 1) {
+            bigNumber_.pop_back();
+            --i;
+        }
+    }
+    return *this;
+}
+
+inline BigInteger &BigInteger::operator-=(const BigInteger &argument) {
+    if (this == &argument) {
+        *this = 0;
+        return *this;
+    }
+    if (sign_ * argument.sign_ >= 0)
+        subtraction(argument);
+    else
+        addition(argument);
+    size_t i = bigNumber_.size() - 1;
+    while (bigNumber_[i] == 0 && bigNumber_.size() > 1) {
+        bigNumber_.pop_back();
+        --i;
+    }
+    return *this;
+}
+
+inline BigInteger &BigInteger::operator*=(const BigInteger &argument) {
+    if (sign_ == 0 || argument.sign_ == 0) {
+        *this = BigInteger(0ll);
+        return *this;
+    }
+    LimbVector product(length() + argument.length());
+    if (this == &argument)
+        squareLimbs(bigNumber_.data(), length(), product.data());
+    else
+        multiplyLimbs(bigNumber_.data(), length(), argument.bigNumber_.data(), argument.length(),
+                      product.data());
+    bigNumber_.swap(product);
+    sign_ *= argument.sign_;
+    removeLeadingZeros();
+    return *this;
+}
+
+inline void BigInteger::accumulateProduct(const BigInteger &lhs, const BigInteger &rhs, int productSign) {
+    if (productSign == 0) return;
+    if (&lhs == this || &rhs == this) {
+        BigInteger copy(*this);
+        accumulateProduct(&lhs == this ? copy : lhs, &rhs == this ? copy : rhs, productSign);
+        return;
+    }
+    const unsigned long long *longer = lhs.bigNumber_.data();
+    const unsigned long long *shorter = rhs.bigNumber_.data();
+    size_t longerSize = lhs.length();
+    size_t shorterSize = rhs.length();
+    if (longerSize < shorterSize) {
+        std::swap(longer, shorter);
+        std::swap(longerSize, shorterSize);
+    }
+    if (sign_ == 0) sign_ = productSign;
+    bool adding = sign_ == productSign;
+    size_t size = std::max(length(), longerSize + shorterSize) + 1;
+    bigNumber_.resize(size, 0);
+    unsigned long long *target = bigNumber_.data();
+    if (shorterSize < karatsubaThreshold) {
+        for (size_t i = 0; i < shorterSize; ++i) {
+            if (adding) {
+                unsigned long long carry = addMultipleLimbs(target + i, longer, longerSize, shorter[i]);
+                addLimbs(target + i + longerSize, size - i - longerSize, &carry, 1);
+            } else {
+                unsigned long long borrow = subtractMultipleLimbs(target + i, longer, longerSize, shorter[i]);
+                subtractLimbs(target + i + longerSize, size - i - longerSize, &borrow, 1);
+            }
+        }
+    } else {
+        LimbVector product(longerSize + shorterSize);
+        multiplyLimbs(longer, longerSize, shorter, shorterSize, product.data());
+        if (adding)
+            addLimbs(target, size, product.data(), product.size());
+        else
+            subtractLimbs(target, size, product.data(), product.size());
+    }
+    if (!adding && bigNumber_.back() != 0) {
+        unsigned long long carry = 1;
+        for (unsigned long long &limb: bigNumber_) {
+            limb = ~limb + carry;
+            carry = carry && limb == 0;
+        }
+        sign_ = -sign_;
+    }
+    removeLeadingZeros();
+}
+
+inline void BigInteger::schoolbookDivide(const BigInteger &dividend, const BigInteger &divisor,
+                                         BigInteger &quotient, BigInteger &remainder) {
+    if (dividend.sign_ == 0 || dividend.compare(divisor)) {
+        remainder = dividend;
+        remainder.sign_ = remainder.sign_ != 0;
+        quotient = 0;
+        return;
+    }
+    LimbVector quotientLimbs(dividend.length() - divisor.length() + 1, 0);
+    LimbVector remainderLimbs(divisor.length(), 0);
+    if (divisor.length() == 1) {
+        unsigned long long rest = 0;
+        for (size_t i = dividend.length(); i > 0; --i) {
+            unsigned __int128 current = ((unsigned __int128) rest << 64) | dividend.bigNumber_[i - 1];
+            quotientLimbs[i - 1] = (unsigned long long) (current / divisor.bigNumber_[0]);
+            rest = (unsigned long long) (current % divisor.bigNumber_[0]);
+        }
+        remainderLimbs[0] = rest;
+    } else {
+        knuthDivide(dividend.bigNumber_.data(), dividend.length(), divisor.bigNumber_.data(),
+                    divisor.length(), quotientLimbs.data(), remainderLimbs.data());
+    }
+    quotient.bigNumber_.swap(quotientLimbs);
+    quotient.sign_ = 1;
+    quotient.removeLeadingZeros();
+    remainder.bigNumber_.swap(remainderLimbs);
+    remainder.sign_ = 1;
+    remainder.removeLeadingZeros();
+}
+
+inline BigInteger BigInteger::limbRange(const BigInteger &argument, size_t from, size_t count) {
+    if (from >= argument.length()) return BigInteger();
+    return fromLimbs(argument.bigNumber_.data() + from, std::min(count, argument.length() - from));
+}
+
+inline void BigInteger::divideThreeByTwo(const BigInteger &dividend, const BigInteger &divisor,
+                                         size_t half, BigInteger &quotient, BigInteger &remainder) {
+    BigInteger upper = limbRange(dividend, half, 2 * half);
+    BigInteger divisorHigh = limbRange(divisor, half, half);
+    BigInteger rest;
+    if (limbRange(dividend, 2 * half, half).compare(divisorHigh)) {
+        divideTwoByOne(upper, divisorHigh, half, quotient, rest);
+    } else {
+        quotient.bigNumber_.assign(half, ~0ull);
+        quotient.sign_ = 1;
+        rest = upper + divisorHigh;
+        divisorHigh.shiftLimbs(half);
+        rest -= divisorHigh;
+    }
+    rest.shiftLimbs(half);
+    rest += limbRange(dividend, 0, half);
+    rest -= quotient * limbRange(divisor, 0, half);
+    while (rest.sign_ < 0) {
+        --quotient;
+        rest += divisor;
+    }
+    remainder = rest;
+}
+
+inline void BigInteger::divideTwoByOne(const BigInteger &dividend, const BigInteger &divisor,
+                                       size_t size, BigInteger &quotient, BigInteger &remainder) {
+    if (size % 2 == 1 || size < burnikelZieglerThreshold) {
+        schoolbookDivide(dividend, divisor, quotient, remainder);
+        return;
+    }
+    size_t half = size / 2;
+    BigInteger high;
+    BigInteger rest;
+    divideThreeByTwo(limbRange(dividend, half, 3 * half), divisor, half, high, rest);
+    rest.shiftLimbs(half);
+    rest += limbRange(dividend, 0, half);
+    divideThreeByTwo(rest, divisor, half, quotient, remainder);
+    high.shiftLimbs(half);
+    quotient += high;
+}
+
+inline void BigInteger::burnikelZieglerDivide(const BigInteger &dividend, const BigInteger &divisor,
+                                              BigInteger &quotient, BigInteger &remainder) {
+    size_t blocks = 1;
+    while (blocks * std::max<size_t>(burnikelZieglerThreshold, 2) < divisor.length()) blocks <<= 1;
+    size_t size = (divisor.length() + blocks - 1) / blocks * blocks;
+    size_t shift = (size - divisor.length()) * 64 + __builtin_clzll(divisor.bigNumber_.back());
+
+    BigInteger normalizedDivisor = divisor;
+    normalizedDivisor.sign_ = 1;
+    normalizedDivisor.shiftLeft(shift);
+    BigInteger normalizedDividend = dividend;
+    normalizedDividend.sign_ = 1;
+    normalizedDividend.shiftLeft(shift);
+
+    size_t count = std::max<size_t>(2, normalizedDividend.length() / size + 1);
+    LimbVector quotientLimbs(count * size, 0);
+    BigInteger current = limbRange(normalizedDividend, (count - 2) * size, 2 * size);
+    BigInteger part;
+    BigInteger rest;
+    for (size_t i = count - 1; i > 0; --i) {
+        divideTwoByOne(current, normalizedDivisor, size, part, rest);
+        if (part.sign_ != 0)
+            std::copy(part.bigNumber_.begin(), part.bigNumber_.end(),
+                      quotientLimbs.begin() + (i - 1) * size);
+        if (i > 1) {
+            rest.shiftLimbs(size);
+            rest += limbRange(normalizedDividend, (i - 2) * size, size);
+            current = rest;
+        }
+    }
+    quotient.bigNumber_.swap(quotientLimbs);
+    quotient.sign_ = 1;
+    quotient.removeLeadingZeros();
+    remainder = rest;
+    remainder.shiftRight(shift);
+}
+
+inline void BigInteger::divide(const BigInteger &dividend, const BigInteger &divisor,
+                               BigInteger &quotient, BigInteger &remainder) {
+    int quotientSign = dividend.sign_ * divisor.sign_;
+    int remainderSign = dividend.sign_;
+    if (divisor.length() >= burnikelZieglerThreshold &&
+        dividend.length() >= divisor.length() + burnikelZieglerThreshold)
+        burnikelZieglerDivide(dividend, divisor, quotient, remainder);
+    else
+        schoolbookDivide(dividend, divisor, quotient, remainder);
+    quotient.sign_ *= quotientSign;
+    remainder.sign_ *= remainderSign;
+}
+
+inline std::pair<BigInteger, BigInteger> BigInteger::divmod(const BigInteger &dividend,
+                                                            const BigInteger &divisor) {
+    std::pair<BigInteger, BigInteger> result;
+    divide(dividend, divisor, result.first, result.second);
+    return result;
+}
+
+inline BigInteger &BigInteger::operator/=(const BigInteger &argument) {
+    BigInteger remainder;
+    divide(*this, argument, *this, remainder);
+    return *this;
+}
+
+// Only valid when argument divides *this: the quotient is built from the low limbs upwards with the 2-adic
+// inverse of the divisor, so no quotient digit has to be estimated and corrected.
+inline BigInteger &BigInteger::divideExact(const BigInteger &argument) {
+    if (sign_ == 0) return *this;
+    int quotientSign = sign_ * argument.sign_;
+    BigInteger divisor(argument);
+    size_t zeros = divisor.trailingZeros();
+    divisor.shiftRight(zeros);
+    shiftRight(zeros);
+    if (length() < divisor.length()) {
+        *this = 0;
+        return *this;
+    }
+    size_t size = length() - divisor.length() + 1;
+    std::vector<unsigned long long> remainder(bigNumber_.data(), bigNumber_.data() + size);
+    std::vector<unsigned long long> quotient(size);
+    unsigned long long inverse = -montgomeryInverse(divisor.bigNumber_[0]);
+    for (size_t i = 0; i < size; ++i) {
+        quotient[i] = remainder[i] * inverse;
+        size_t span = std::min(divisor.length(), size - i);
+        unsigned long long borrow = subtractMultipleLimbs(&remainder[i], divisor.bigNumber_.data(), span, quotient[i]);
+        if (i + span < size) subtractLimbs(&remainder[i + span], size - i - span, &borrow, 1);
+    }
+    *this = fromLimbs(quotient.data(), size);
+    sign_ *= quotientSign;
+    return *this;
+}
+
+inline BigInteger operator/(const BigInteger &lhs, const BigInteger &rhs) {
+    BigInteger newBigInteger(lhs);
+    newBigInteger /= rhs;
+    return newBigInteger;
+}
+
+inline BigInteger operator/(BigInteger &&lhs, const BigInteger &rhs) {
+    lhs /= rhs;
+    return std::move(lhs);
+}
+
+inline BigInteger &BigInteger::operator%=(const BigInteger &argument) {
+    BigInteger quotient;
+    divide(*this, argument, quotient, *this);
+    return *this;
+}
+
+inline BigInteger operator%(const BigInteger &lhs, const BigInteger &rhs) {
+    BigInteger newBigInteger(lhs);
+    newBigInteger %= rhs;
+    return newBigInteger;
+}
+
+inline BigInteger operator%(BigInteger &&lhs, const BigInteger &rhs) {
+    lhs %= rhs;
+    return std::move(lhs);
+}
+
+
+inline BigInteger BigInteger::pow(const BigInteger &base, unsigned long long exponent) {
+    if (exponent == 0) return BigInteger(1ll);
+    if (base.sign_ == 0) return base;
+    BigInteger power = fromLimbs(&exponent, 1);
+    size_t window = windowBits(power.bitLength());
+    std::vector<LimbVector> table(size_t(1) << (window - 1), base.bigNumber_);
+    if (table.size() > 1) {
+        LimbVector square(2 * base.length());
+        squareLimbs(base.bigNumber_.data(), base.length(), square.data());
+        square.resize(significantLimbs(square.data(), square.size()));
+        for (size_t i = 1; i < table.size(); ++i) {
+            table[i].resize(table[i - 1].size() + square.size());
+            multiplyLimbs(table[i - 1].data(), table[i - 1].size(), square.data(), square.size(), table[i].data());
+            table[i].resize(significantLimbs(table[i].data(), table[i].size()));
+        }
+    }
+    size_t capacity = base.bitLength() * exponent / 64 + 2;
+    LimbVector result(capacity);
+    LimbVector scratch(capacity);
+    size_t size = 0;
+    slidingWindow(power, window, [&]() {
+        squareLimbs(result.data(), size, scratch.data());
+        size = significantLimbs(scratch.data(), 2 * size);
+        result.swap(scratch);
+    }, [&](size_t index) {
+        const LimbVector &factor = table[index];
+        if (size == 0) {
+            std::copy(factor.begin(), factor.end(), result.begin());
+            size = factor.size();
+            return;
+        }
+        multiplyLimbs(result.data(), size, factor.data(), factor.size(), scratch.data());
+        size = significantLimbs(scratch.data(), size + factor.size());
+        result.swap(scratch);
+    });
+    BigInteger answer;
+    result.resize(size);
+    answer.bigNumber_.swap(result);
+    answer.sign_ = base.sign_ < 0 && (exponent & 1) ? -1 : 1;
+    return answer;
+}
+
+inline BigInteger BigInteger::powmod(const BigInteger &base, const BigInteger &exponent, const BigInteger &modulus) {
+    BigInteger residue = base % modulus;
+    if (residue.sign_ < 0) residue += modulus;
+    BigInteger one(1ll);
+    if (modulus == one) return BigInteger(0ll);
+    size_t window = windowBits(exponent.sign_ == 0 ? 0 : exponent.bitLength());
+    if ((modulus.bigNumber_[0] & 1) == 0) {
+        std::vector<BigInteger> table(size_t(1) << (window - 1), residue);
+        BigInteger square = residue * residue % modulus;
+        for (size_t i = 1; i < table.size(); ++i) table[i] = table[i - 1] * square % modulus;
+        BigInteger result = one;
+        slidingWindow(exponent, window, [&]() {
+            result *= result;
+            result %= modulus;
+        }, [&](size_t index) {
+            result *= table[index];
+            result %= modulus;
+        });
+        return result;
+    }
+    size_t size = modulus.length();
+    unsigned long long inverse = montgomeryInverse(modulus.bigNumber_[0]);
+    const unsigned long long *limbs = modulus.bigNumber_.data();
+    residue.shiftLimbs(size);
+    residue %= modulus;
+    std::vector<unsigned long long> table(size << (window - 1), 0);
+    std::vector<unsigned long long> scratch(size + 2);
+    std::vector<unsigned long long> square(size);
+    std::vector<unsigned long long> result(size, 0);
+    std::copy(residue.bigNumber_.begin(), residue.bigNumber_.begin() + (residue.sign_ ? residue.length() : 0),
+              table.begin());
+    montgomeryMultiply(table.data(), table.data(), limbs, size, inverse, scratch.data(), square.data());
+    for (size_t i = size; i < table.size(); i += size)
+        montgomeryMultiply(table.data() + i - size, square.data(), limbs, size, inverse, scratch.data(),
+                           table.data() + i);
+    result[0] = 1;
+    bool started = false;
+    slidingWindow(exponent, window, [&]() {
+        montgomeryMultiply(result.data(), result.data(), limbs, size, inverse, scratch.data(), result.data());
+    }, [&](size_t index) {
+        if (started) {
+            montgomeryMultiply(result.data(), table.data() + index * size, limbs, size, inverse, scratch.data(),
+                               result.data());
+        } else {
+            std::copy(table.begin() + index * size, table.begin() + (index + 1) * size, result.begin());
+            started = true;
+        }
+    });
+    if (started) {
+        std::fill(square.begin(), square.end(), 0);
+        square[0] = 1;
+        montgomeryMultiply(result.data(), square.data(), limbs, size, inverse, scratch.data(), result.data());
+    }
+    return fromLimbs(result.data(), size);
+}
+
+inline BigInteger BigInteger::iroot(const BigInteger &argument, unsigned long long degree) {
+    if (argument.sign_ < 0) return -iroot(-argument, degree);
+    if (argument.sign_ == 0 || degree <= 1) return argument;
+    size_t bits = argument.bitLength();
+    if (degree >= bits) return BigInteger(1ll);
+    size_t shift = bits / degree / 2;
+    BigInteger root(1ll);
+    if (shift == 0) {
+        root.shiftLeft((bits + degree - 1) / degree);
+    } else {
+        BigInteger high = argument;
+        high.shiftRight(shift * degree);
+        root = iroot(high, degree) + root;
+        root.shiftLeft(shift);
+    }
+    BigInteger lower((long long) (degree - 1));
+    BigInteger divisor((long long) degree);
+    while (true) {
+        BigInteger next = argument / pow(root, degree - 1);
+        next.addMul(root, lower);
+        next /= divisor;
+        if (!next.compare(root)) return root;
+        root = std::move(next);
+    }
+}
+
+inline void BigInteger::toomMultiply(const unsigned long long *lhs, const unsigned long long *rhs, size_t size,
+                                     unsigned long long *result) {
+    size_t part = (size + 2) / 3;
+    BigInteger lhs0 = fromLimbs(lhs, part);
+    BigInteger lhs1 = fromLimbs(lhs + part, part);
+    BigInteger lhs2 = fromLimbs(lhs + 2 * part, size - 2 * part);
+    BigInteger rhs0 = fromLimbs(rhs, part);
+    BigInteger rhs1 = fromLimbs(rhs + part, part);
+    BigInteger rhs2 = fromLimbs(rhs + 2 * part, size - 2 * part);
+
+    BigInteger lhsOuter = lhs0 + lhs2;
+    BigInteger rhsOuter = rhs0 + rhs2;
+    BigInteger lhsMinusOne = lhsOuter - lhs1;
+    BigInteger rhsMinusOne = rhsOuter - rhs1;
+    BigInteger lhsMinusTwo = (lhsMinusOne + lhs2) * 2 - lhs0;
+    BigInteger rhsMinusTwo = (rhsMinusOne + rhs2) * 2 - rhs0;
+
+    BigInteger atZero = lhs0 * rhs0;
+    BigInteger atOne = (lhsOuter + lhs1) * (rhsOuter + rhs1);
+    BigInteger atMinusOne = lhsMinusOne * rhsMinusOne;
+    BigInteger atMinusTwo = lhsMinusTwo * rhsMinusTwo;
+    BigInteger atInfinity = lhs2 * rhs2;
+
+    BigInteger third = atMinusTwo - atOne;
+    third.divideBySmall(3);
+    BigInteger first = atOne - atMinusOne;
+    first.divideBySmall(2);
+    BigInteger second = atMinusOne - atZero;
+    third = second - third;
+    third.divideBySmall(2);
+    third += atInfinity * 2;
+    second += first;
+    second -= atInfinity;
+    first -= third;
+
+    std::fill(result, result + 2 * size, 0);
+    const BigInteger *coefficients[] = {&atZero, &first, &second, &third, &atInfinity};
+    for (size_t k = 0; k < 5; ++k) {
+        if (coefficients[k]->sign_ == 0) continue;
+        addLimbs(result + k * part, 2 * size - k * part, coefficients[k]->bigNumber_.data(),
+                 coefficients[k]->length());
+    }
+}
+
+inline bool BigInteger::lehmerMatrix(const BigInteger &lhs, const BigInteger &rhs, long long (&matrix)[2][2]) {
+    bool swapped = lhs.compare(rhs);
+    const BigInteger &larger = swapped ? rhs : lhs;
+    const BigInteger &smaller = swapped ? lhs : rhs;
+    size_t bits = larger.bitLength();
+    size_t shift = bits > 62 ? bits - 62 : 0;
+    long long high = (long long) larger.bitsFrom(shift);
+    long long low = (long long) smaller.bitsFrom(shift);
+    long long a = 1, b = 0, c = 0, d = 1;
+    size_t steps = 0;
+    while (low + c > 0 && low + d > 0 && high + a >= 0 && high + b >= 0) {
+        long long quotient = (high + a) / (low + c);
+        if (quotient != (high + b) / (low + d)) break;
+        long long next = a - quotient * c;
+        a = c;
+        c = next;
+        next = b - quotient * d;
+        b = d;
+        d = next;
+        next = high - quotient * low;
+        high = low;
+        low = next;
+        ++steps;
+    }
+    if (steps == 0) return false;
+    if (steps % 2 == 1) {
+        std::swap(a, c);
+        std::swap(b, d);
+    }
+    if (swapped) {
+        matrix[0][0] = d;
+        matrix[0][1] = c;
+        matrix[1][0] = b;
+        matrix[1][1] = a;
+    } else {
+        matrix[0][0] = a;
+        matrix[0][1] = b;
+        matrix[1][0] = c;
+        matrix[1][1] = d;
+    }
+    return true;
+}
+
+inline void BigInteger::applyLehmerMatrix(BigInteger &lhs, BigInteger &rhs, const long long (&matrix)[2][2]) {
+    size_t size = std::max(lhs.length(), rhs.length());
+    LimbVector first(size);
+    LimbVector second(size);
+    combineLimbs(lhs.bigNumber_.data(), lhs.length(), matrix[0][0],
+                 rhs.bigNumber_.data(), rhs.length(), matrix[0][1], first.data(), size);
+    combineLimbs(lhs.bigNumber_.data(), lhs.length(), matrix[1][0],
+                 rhs.bigNumber_.data(), rhs.length(), matrix[1][1], second.data(), size);
+    lhs.bigNumber_.swap(first);
+    lhs.sign_ = 1;
+    lhs.removeLeadingZeros();
+    rhs.bigNumber_.swap(second);
+    rhs.sign_ = 1;
+    rhs.removeLeadingZeros();
+}
+
+inline void BigInteger::applyLehmerCofactors(BigInteger &lhs, BigInteger &rhs, const long long (&matrix)[2][2]) {
+    BigInteger first = lhs * BigInteger(matrix[0][0]);
+    first.addMul(rhs, BigInteger(matrix[0][1]));
+    BigInteger second = lhs * BigInteger(matrix[1][0]);
+    second.addMul(rhs, BigInteger(matrix[1][1]));
+    lhs = std::move(first);
+    rhs = std::move(second);
+}
+
+inline void BigInteger::euclidStep(BigInteger &lhs, BigInteger &rhs, BigInteger *lhsFactor, BigInteger *rhsFactor) {
+    bool reduceLhs = !lhs.compare(rhs);
+    BigInteger &larger = reduceLhs ? lhs : rhs;
+    BigInteger quotient;
+    divide(larger, reduceLhs ? rhs : lhs, quotient, larger);
+    if (lhsFactor == nullptr) return;
+    if (reduceLhs)
+        lhsFactor->subMul(quotient, *rhsFactor);
+    else
+        rhsFactor->subMul(quotient, *lhsFactor);
+}
+
+inline void BigInteger::reducedSteps(BigInteger &lhs, BigInteger &rhs, size_t bits, BigInteger (&matrix)[2][2]) {
+    while ((lhs - rhs).bitLength() > bits) {
+        long long step[2][2];
+        if (!lehmerMatrix(lhs, rhs, step)) break;
+        BigInteger first = lhs;
+        BigInteger second = rhs;
+        applyLehmerMatrix(first, second, step);
+        if (std::min(first.bitLength(), second.bitLength()) <= bits) break;
+        lhs = std::move(first);
+        rhs = std::move(second);
+        for (size_t i = 0; i < 2; ++i) {
+            BigInteger left = matrix[i][0] * BigInteger(step[1][1]);
+            left.subMul(matrix[i][1], BigInteger(step[1][0]));
+            BigInteger right = matrix[i][1] * BigInteger(step[0][0]);
+            right.subMul(matrix[i][0], BigInteger(step[0][1]));
+            matrix[i][0] = std::move(left);
+            matrix[i][1] = std::move(right);
+        }
+    }
+    BigInteger power = 1;
+    power.shiftLeft(bits);
+    while ((lhs - rhs).bitLength() > bits) {
+        bool reduceLhs = rhs.compare(lhs);
+        BigInteger &larger = reduceLhs ? lhs : rhs;
+        const BigInteger &smaller = reduceLhs ? rhs : lhs;
+        if (smaller.sign_ == 0) break;
+        BigInteger quotient;
+        divide(larger - power, smaller, quotient, larger);
+        larger += power;
+        size_t from = reduceLhs ? 0 : 1;
+        matrix[0][1 - from].addMul(quotient, matrix[0][from]);
+        matrix[1][1 - from].addMul(quotient, matrix[1][from]);
+    }
+}
+
+inline void BigInteger::liftHalfGcd(BigInteger &lhs, BigInteger &rhs, size_t split, BigInteger (&matrix)[2][2]) {
+    BigInteger high = lhs;
+    BigInteger low = rhs;
+    high.shiftRight(split);
+    low.shiftRight(split);
+    BigInteger inner[2][2];
+    halfGcd(high, low, inner);
+    if (inner[0][1].sign_ == 0 && inner[1][0].sign_ == 0) return;
+    BigInteger lhsLow = lhs.lowBits(split);
+    BigInteger rhsLow = rhs.lowBits(split);
+    BigInteger first = lhsLow * inner[1][1];
+    first.subMul(rhsLow, inner[0][1]);
+    BigInteger second = rhsLow * inner[0][0];
+    second.subMul(lhsLow, inner[1][0]);
+    high.shiftLeft(split);
+    low.shiftLeft(split);
+    first += high;
+    second += low;
+    if (first.sign_ < 0 || second.sign_ < 0) return;
+    lhs = std::move(first);
+    rhs = std::move(second);
+    for (size_t i = 0; i < 2; ++i) {
+        BigInteger left = matrix[i][0] * inner[0][0];
+        left.addMul(matrix[i][1], inner[1][0]);
+        BigInteger right = matrix[i][0] * inner[0][1];
+        right.addMul(matrix[i][1], inner[1][1]);
+        matrix[i][0] = std::move(left);
+        matrix[i][1] = std::move(right);
+    }
+}
+
+inline void BigInteger::halfGcd(BigInteger &lhs, BigInteger &rhs, BigInteger (&matrix)[2][2]) {
+    matrix[0][0] = 1;
+    matrix[0][1] = 0;
+    matrix[1][0] = 0;
+    matrix[1][1] = 1;
+    size_t bits = std::max(lhs.bitLength(), rhs.bitLength());
+    size_t half = bits / 2 + 1;
+    if (std::min(lhs.bitLength(), rhs.bitLength()) <= half) return;
+    if (bits >= 64 * halfGcdThreshold) {
+        size_t total = bits;
+        liftHalfGcd(lhs, rhs, bits / 2, matrix);
+        bits = std::max(lhs.bitLength(), rhs.bitLength());
+        if (2 * half + 1 > bits && 16 * (bits - half) <= 7 * total)
+            liftHalfGcd(lhs, rhs, 2 * half + 1 - bits, matrix);
+    }
+    reducedSteps(lhs, rhs, half, matrix);
+}
+
+inline BigInteger BigInteger::gcd(const BigInteger &lhs, const BigInteger &rhs) {
+    BigInteger first = lhs;
+    BigInteger second = rhs;
+    first.sign_ = first.sign_ != 0;
+    second.sign_ = second.sign_ != 0;
+    if (first.sign_ == 0) return second;
+    if (second.sign_ == 0) return first;
+    size_t firstZeros = first.trailingZeros();
+    size_t secondZeros = second.trailingZeros();
+    first.shiftRight(firstZeros);
+    second.shiftRight(secondZeros);
+    while (first.length() > 1 && second.length() > 1) {
+        long long matrix[2][2];
+        if (std::min(first.length(), second.length()) >= halfGcdThreshold) {
+            BigInteger reduction[2][2];
+            halfGcd(first, second, reduction);
+            euclidStep(first, second, nullptr, nullptr);
+        } else if (lehmerMatrix(first, second, matrix)) {
+            applyLehmerMatrix(first, second, matrix);
+        } else {
+            euclidStep(first, second, nullptr, nullptr);
+        }
+    }
+    BigInteger result;
+    if (first.sign_ == 0 || second.sign_ == 0) {
+        result = first.sign_ == 0 ? second : first;
+    } else {
+        if (first.length() > 1) std::swap(first, second);
+        unsigned long long small = first.bigNumber_[0];
+        small = binaryGcd(small, second.divideBySmall(small));
+        result = fromLimbs(&small, 1);
+    }
+    result.shiftLeft(std::min(firstZeros, secondZeros));
+    return result;
+}
+
+inline BigInteger BigInteger::extendedGcd(const BigInteger &lhs, const BigInteger &rhs,
+                                          BigInteger &lhsFactor, BigInteger &rhsFactor) {
+    BigInteger first = lhs;
+    BigInteger second = rhs;
+    first.sign_ = first.sign_ != 0;
+    second.sign_ = second.sign_ != 0;
+    BigInteger firstFactor = 1;
+    BigInteger secondFactor = 0;
+    while (first.sign_ != 0 && second.sign_ != 0) {
+        long long matrix[2][2];
+        size_t shortest = std::min(first.length(), second.length());
+        if (shortest >= halfGcdThreshold) {
+            BigInteger reduction[2][2];
+            halfGcd(first, second, reduction);
+            BigInteger factor = firstFactor * reduction[1][1];
+            factor.subMul(secondFactor, reduction[0][1]);
+            secondFactor *= reduction[0][0];
+            secondFactor.subMul(firstFactor, reduction[1][0]);
+            firstFactor = std::move(factor);
+            euclidStep(first, second, &firstFactor, &secondFactor);
+        } else if (shortest > 1 && lehmerMatrix(first, second, matrix)) {
+            applyLehmerMatrix(first, second, matrix);
+            applyLehmerCofactors(firstFactor, secondFactor, matrix);
+        } else {
+            euclidStep(first, second, &firstFactor, &secondFactor);
+        }
+    }
+    bool firstLeft = first.sign_ != 0;
+    BigInteger result = firstLeft ? first : second;
+    lhsFactor = firstLeft ? firstFactor : secondFactor;
+    if (rhs.sign_ == 0) {
+        rhsFactor = 0;
+    } else {
+        BigInteger absolute = lhs;
+        absolute.sign_ = absolute.sign_ != 0;
+        rhsFactor = result;
+        rhsFactor.subMul(absolute, lhsFactor);
+        rhsFactor /= rhs;
+    }
+    lhsFactor.sign_ *= lhs.sign_ < 0 ? -1 : 1;
+    return result;
+}
+
+inline void BigInteger::reduction(BigInteger &num, BigInteger &den) {
+    BigInteger divisor = gcd(num, den);
+    if (divisor.length() == 1 && divisor.bigNumber_[0] == 1) return;
+    num /= divisor;
+    den /= divisor;
+}
+
+class Rational {
+private:
+    BigInteger numerator_;
+    BigInteger denominator_;
+    int sign_;
+
+    template <typename Sink>
+    class DecimalWriter {
+    public:
+        DecimalWriter(Sink &sink, size_t integerWidth, bool fraction, size_t chunk)
+                : sink_(sink), integerWidth_(integerWidth), fraction_(fraction), chunk_(chunk) {
+            buffer_.reserve(chunk);
+        }
+
+        void operator()(const char *digits, size_t count) {
+            for (; integerWidth_ > 0 && count > 0; ++digits, --count) {
+                --integerWidth_;
+                if (leading_ && *digits == '0' && integerWidth_ > 0) continue;
+                leading_ = false;
+                buffer_.push_back(*digits);
+                if (integerWidth_ == 0 && fraction_) buffer_.push_back('.');
+            }
+            buffer_.append(digits, count);
+            if (buffer_.size() >= chunk_) flush();
+        }
+
+        void flush() {
+            if (!buffer_.empty()) sink_(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+
+    private:
+        Sink &sink_;
+        size_t integerWidth_;
+        bool fraction_;
+        bool leading_ = true;
+        size_t chunk_;
+        std::string buffer_;
+    };
+
+    static long double leadingBits(const BigInteger &value, long &exponent) {
+        size_t bits = value.bitLength();
+        size_t shift = bits > 64 ? bits - 64 : 0;
+        exponent += shift;
+        return (long double) value.bitsFrom(shift);
+    }
+
+    int compareMagnitude(const Rational &argument) const {
+        // Zero has no leading bits, so the shortcuts below only hold for two non-zero numerators.
+        if (numerator_.BigIntegerSign() == 0 || argument.numerator_.BigIntegerSign() == 0)
+            return (numerator_.BigIntegerSign() != 0) - (argument.numerator_.BigIntegerSign() != 0);
+        size_t left = numerator_.bitLength() + argument.denominator_.bitLength();
+        size_t right = argument.numerator_.bitLength() + denominator_.bitLength();
+        if (left >= right + 2) return 1;
+        if (right >= left + 2) return -1;
+        long leftExponent = 0;
+        long rightExponent = 0;
+        long double leftEstimate = leadingBits(numerator_, leftExponent) *
+                                   leadingBits(argument.denominator_, leftExponent);
+        long double rightEstimate = leadingBits(argument.numerator_, rightExponent) *
+                                    leadingBits(denominator_, rightExponent);
+        leftEstimate = std::ldexp(leftEstimate, int(leftExponent - rightExponent));
+        if (leftEstimate > rightEstimate * (1 + 0x1p-48L)) return 1;
+        if (leftEstimate < rightEstimate * (1 - 0x1p-48L)) return -1;
+        BigInteger up = numerator_ * argument.denominator_;
+        BigInteger down = denominator_ * argument.numerator_;
+        if (up.compare(down)) return -1;
+        return down.compare(up) ? 1 : 0;
+    }
+
+    static void crossCancel(BigInteger &numerator, BigInteger &denominator,
+                            const BigInteger &otherNumerator, const BigInteger &otherDenominator) {
+        BigInteger first = BigInteger::gcd(numerator, otherDenominator);
+        BigInteger second = BigInteger::gcd(denominator, otherNumerator);
+        if (first != 1) numerator /= first;
+        if (second != 1) denominator /= second;
+        numerator *= second != 1 ? otherNumerator / second : otherNumerator;
+        denominator *= first != 1 ? otherDenominator / first : otherDenominator;
+    }
+
+    void accumulate(const Rational &argument, int argumentSign) {
+        BigInteger common = BigInteger::gcd(denominator_, argument.denominator_);
+        bool coprime = common == 1;
+        BigInteger scale = coprime ? denominator_ : denominator_ / common;
+        if (sign_ == -1) numerator_.invert();
+        if (coprime)
+            numerator_ *= argument.denominator_;
+        else
+            numerator_ *= argument.denominator_ / common;
+        if (argumentSign > 0)
+            numerator_.addMul(scale, argument.numerator_);
+        else
+            numerator_.subMul(scale, argument.numerator_);
+        sign_ = numerator_.BigIntegerSign();
+        if (sign_ == -1) numerator_.invert();
+        if (sign_ == 0) {
+            denominator_ = 1;
+            return;
+        }
+        if (coprime) {
+            denominator_ *= argument.denominator_;
+            return;
+        }
+        BigInteger factor = BigInteger::gcd(numerator_, common);
+        if (factor != 1) numerator_ /= factor;
+        denominator_ = scale * (argument.denominator_ / factor);
+    }
+
+    void accumulateProduct(const Rational &lhs, const Rational &rhs, int productSign) {
+        if (productSign == 0) return;
+        if (this == &lhs || this == &rhs) {
+            Rational copy = *this;
+            accumulateProduct(this == &lhs ? copy : lhs, this == &rhs ? copy : rhs, productSign);
+            return;
+        }
+        if (sign_ == -1) numerator_.invert();
+        BigInteger scaled = denominator_ * lhs.numerator_;
+        numerator_ *= lhs.denominator_;
+        numerator_ *= rhs.denominator_;
+        if (productSign > 0)
+            numerator_.addMul(scaled, rhs.numerator_);
+        else
+            numerator_.subMul(scaled, rhs.numerator_);
+        denominator_ *= lhs.denominator_;
+        denominator_ *= rhs.denominator_;
+        sign_ = numerator_.BigIntegerSign();
+        if (sign_ == -1) numerator_.invert();
+        numerator_.reduction(numerator_, denominator_);
+    }
+
+public:
+    static inline size_t decimalChunkSize = 1 << 16;
+
+    Rational(int x) {
+        if (x == 0) {
+            sign_ = 0;
+        }
+        if (x > 0) {
+            sign_ = 1;
+        }
+        if (x < 0) {
+            sign_ = -1;
+            x = -x;
+        }
+        numerator_ = x;
+        denominator_ = 1;
+    }
+
+
+    Rational(const BigInteger &up, const BigInteger &down = 1) : numerator_(up), denominator_(down) {
+        sign_ = up.BigIntegerSign() * down.BigIntegerSign();
+        if (up.BigIntegerSign() == -1) numerator_.invert();
+        if (down.BigIntegerSign() == -1) denominator_.invert();
+        up.reduction(numerator_, denominator_);
+    }
+
+
+    Rational() : Rational(0) {}
+
+    int BigIntegerSign() const { return sign_; }
+
+    BigInteger numerator() const { return sign_ < 0 ? -numerator_ : numerator_; }
+
+    const BigInteger &denominator() const { return denominator_; }
+
+    Rational operator-() const {
+        Rational newRational(*this);
+        newRational.sign_ = -sign_;
+        return newRational;
+    }
+
+    const std::string toString() const {
+        std::string result;
+        if (sign_ == -1) result.push_back('-');
+        numerator_.appendTo(result);
+        if (denominator_ != 1) {
+            result += '/';
+            denominator_.appendTo(result);
+        }
+        return result;
+    }
+
+    bool compare(const Rational &argument) const {
+        return compareMagnitude(argument) < 0;
+    }
+
+    int compareTo(const Rational &argument) const {
+        if (sign_ != argument.sign_) return sign_ < argument.sign_ ? -1 : 1;
+        if (sign_ == 0) return 0;
+        return sign_ * compareMagnitude(argument);
+    }
+
+    Rational &operator+=(const Rational &argument) {
+        if (this == &argument) {
+            Rational copy = argument;
+            return *this += copy;
+        }
+        accumulate(argument, argument.sign_);
+        return *this;
+    }
+
+    Rational &operator-=(const Rational &argument) {
+        if (this == &argument) {
+            Rational copy = argument;
+            return *this -= copy;
+        }
+        accumulate(argument, -argument.sign_);
+        return *this;
+    }
+
+    Rational &operator*=(const Rational &argument) {
+        if (this == &argument) {
+            Rational copy = argument;
+            return *this *= copy;
+        }
+        sign_ *= argument.sign_;
+        if (sign_ == 0) {
+            numerator_ = 0;
+            denominator_ = 1;
+            return *this;
+        }
+        crossCancel(numerator_, denominator_, argument.numerator_, argument.denominator_);
+        return *this;
+    }
+
+    Rational &operator/=(const Rational &argument) {
+        if (this == &argument) {
+            Rational copy = argument;
+            return *this /= copy;
+        }
+        sign_ *= argument.sign_;
+        crossCancel(numerator_, denominator_, argument.denominator_, argument.numerator_);
+        return *this;
+    }
+
+    Rational &addMul(const Rational &lhs, const Rational &rhs) {
+        accumulateProduct(lhs, rhs, lhs.sign_ * rhs.sign_);
+        return *this;
+    }
+
+    Rational &subMul(const Rational &lhs, const Rational &rhs) {
+        accumulateProduct(lhs, rhs, -lhs.sign_ * rhs.sign_);
+        return *this;
+    }
+
+    template <typename Sink>
+    void expandDecimal(size_t precision, Sink sink, size_t chunk = decimalChunkSize) const {
+        if (sign_ == -1) sink("-", 1);
+        BigInteger scaled = numerator_ * BigInteger::decimalScale(precision);
+        if (denominator_ != 1) scaled /= denominator_;
+        size_t width = std::max(BigInteger::decimalWidth(scaled), precision + 1);
+        DecimalWriter<Sink> writer(sink, width - precision, precision != 0, chunk);
+        BigInteger::streamDecimal(scaled, width, writer);
+        writer.flush();
+    }
+
+    std::string asDecimal(size_t precision) const {
+        std::string result;
+        expandDecimal(precision, [&result](const char *digits, size_t count) { result.append(digits, count); });
+        return result;
+    }
+
+    explicit operator double() const {
+        if (sign_ == 0) return 0;
+        long exponent = long(numerator_.bitLength()) - long(denominator_.bitLength());
+        if (exponent > 1100) return sign_ * HUGE_VAL;
+        if (exponent < -1100) return sign_ * 0.0;
+        long shift = 63 - exponent;
+        BigInteger up = numerator_;
+        BigInteger down = denominator_;
+        if (shift > 0)
+            up.shiftLeft(shift);
+        else
+            down.shiftLeft(-shift);
+        std::pair<BigInteger, BigInteger> parts = BigInteger::divmod(up, down);
+        unsigned long long quotient = parts.first.bigNumber_[0];
+        int bits = 64 - __builtin_clzll(quotient);
+        long top = bits - 1 - shift;
+        int precision = top >= -1022 ? 53 : int(top + 1075);
+        if (precision < 0) return sign_ * 0.0;
+        int drop = bits - precision;
+        unsigned __int128 mantissa = (unsigned __int128) quotient >> drop;
+        unsigned __int128 rest = quotient & (((unsigned __int128) 1 << drop) - 1);
+        unsigned __int128 half = (unsigned __int128) 1 << (drop - 1);
+        if (rest > half || (rest == half && (parts.second.sign_ != 0 || (mantissa & 1)))) ++mantissa;
+        return sign_ * std::ldexp(double(mantissa), int(top - precision + 1));
+    }
+
+    friend std::ostream &operator<<(std::ostream &Ostream,
+                                    const Rational &argument);
+
+    friend bool operator==(const Rational &lhs, const Rational &rhs);
+
+    friend class LazyRational;
+};
+
+inline std::istream &operator>>(std::istream &Istream, Rational &argument) {
+    BigInteger inputBiginteger;
+    Istream >> inputBiginteger;
+    argument = Rational(inputBiginteger);
+    return Istream;
+}
+
+inline std::ostream &operator<<(std::ostream &Ostream, const Rational &argument) {
+    if (argument.sign_ == -1) Ostream << '-';
+    if (argument.denominator_ == 1)
+        Ostream << argument.numerator_;
+    else
+        Ostream << argument.numerator_ << "/" << argument.denominator_;
+    return Ostream;
+}
+
+inline bool operator==(const Rational &lhs, const Rational &rhs) {
+    return lhs.sign_ == rhs.sign_ && lhs.numerator_ == rhs.numerator_ && lhs.denominator_ == rhs.denominator_;
+}
+
+inline bool operator<(const Rational &lhs, const Rational &rhs) {
+    return lhs.compareTo(rhs) < 0;
+}
+
+inline bool operator>(const Rational &lhs, const Rational &rhs) {
+    return rhs < lhs;
+}
+
+inline bool operator<=(const Rational &lhs, const Rational &rhs) {
+    return !(lhs > rhs);
+}
+
+inline bool operator>=(const Rational &lhs, const Rational &rhs) {
+    return !(lhs < rhs);
+}
+
+inline bool operator!=(const Rational &lhs, const Rational &rhs) {
+    return !(lhs == rhs);
+}
+
+inline Rational operator+(const Rational &lhs, const Rational &rhs) {
+    Rational newRational(lhs);
+    newRational += rhs;
+    return newRational;
+}
+
+inline Rational operator-(const Rational &lhs, const Rational &rhs) {
+    Rational newRational(lhs);
+    newRational -= rhs;
+    return newRational;
+}
+
+inline Rational operator*(const Rational &lhs, const Rational &rhs) {
+    Rational newRational(lhs);
+    newRational *= rhs;
+    return newRational;
+}
+
+inline Rational operator/(const Rational &lhs, const Rational &rhs) {
+    Rational newRational(lhs);
+    newRational /= rhs;
+    return newRational;
+}
+
+class LazyRational {
+private:
+    mutable BigInteger numerator_;
+    mutable BigInteger denominator_;
+    mutable bool normalized_;
+    mutable size_t normalizedBits_;
+
+    void deferred() {
+        normalized_ = false;
+        if (denominator_.bitLength() > 2 * normalizedBits_ + 1024) normalize();
+    }
+
+    void accumulate(const LazyRational &argument, bool adding) {
+        if (denominator_ == argument.denominator_) {
+            if (adding)
+                numerator_ += argument.numerator_;
+            else
+                numerator_ -= argument.numerator_;
+        } else {
+            numerator_ *= argument.denominator_;
+            if (adding)
+                numerator_.addMul(denominator_, argument.numerator_);
+            else
+                numerator_.subMul(denominator_, argument.numerator_);
+            denominator_ *= argument.denominator_;
+        }
+        deferred();
+    }
+
+public:
+    LazyRational(int x) : numerator_(x), denominator_(1), normalized_(true), normalizedBits_(1) {}
+
+    LazyRational(const BigInteger &up, const BigInteger &down = 1)
+            : numerator_(up), denominator_(down), normalized_(false), normalizedBits_(0) {
+        normalize();
+    }
+
+    LazyRational(const Rational &argument)
+            : numerator_(argument.numerator_), denominator_(argument.denominator_), normalized_(true),
+              normalizedBits_(argument.denominator_.bitLength()) {
+        if (argument.sign_ == -1) numerator_.invert();
+    }
+
+    LazyRational() : LazyRational(0) {}
+
+    void normalize() const {
+        if (normalized_) return;
+        if (denominator_.BigIntegerSign() < 0) {
+            numerator_.invert();
+            denominator_.invert();
+        }
+        BigInteger divisor = BigInteger::gcd(numerator_, denominator_);
+        if (divisor != 1) {
+            numerator_ /= divisor;
+            denominator_ /= divisor;
+        }
+        normalized_ = true;
+        normalizedBits_ = denominator_.bitLength();
+    }
+
+    Rational toRational() const {
+        normalize();
+        Rational result;
+        result.numerator_ = numerator_;
+        result.denominator_ = denominator_;
+        result.sign_ = numerator_.BigIntegerSign();
+        if (result.sign_ == -1) result.numerator_.invert();
+        return result;
+    }
+
+    int BigIntegerSign() const { return numerator_.BigIntegerSign(); }
+
+    LazyRational operator-() const {
+        LazyRational newRational(*this);
+        newRational.numerator_.invert();
+        return newRational;
+    }
+
+    const std::string toString() const { return toRational().toString(); }
+
+    template <typename Sink>
+    void expandDecimal(size_t precision, Sink sink, size_t chunk = Rational::decimalChunkSize) const {
+        toRational().expandDecimal(precision, sink, chunk);
+    }
+
+    std::string asDecimal(size_t precision) const { return toRational().asDecimal(precision); }
+
+    explicit operator double() const { return double(toRational()); }
+
+    LazyRational &operator+=(const LazyRational &argument) {
+        if (this == &argument) {
+            LazyRational copy = argument;
+            return *this += copy;
+        }
+        accumulate(argument, true);
+        return *this;
+    }
+
+    LazyRational &operator-=(const LazyRational &argument) {
+        if (this == &argument) {
+            LazyRational copy = argument;
+            return *this -= copy;
+        }
+        accumulate(argument, false);
+        return *this;
+    }
+
+    LazyRational &operator*=(const LazyRational &argument) {
+        if (this == &argument) {
+            LazyRational copy = argument;
+            return *this *= copy;
+        }
+        if (normalized_ && argument.normalized_) {
+            Rational::crossCancel(numerator_, denominator_, argument.numerator_, argument.denominator_);
+            normalizedBits_ = denominator_.bitLength();
+            return *this;
+        }
+        numerator_ *= argument.numerator_;
+        denominator_ *= argument.denominator_;
+        deferred();
+        return *this;
+    }
+
+    LazyRational &operator/=(const LazyRational &argument) {
+        if (this == &argument) {
+            LazyRational copy = argument;
+            return *this /= copy;
+        }
+        if (normalized_ && argument.normalized_) {
+            Rational::crossCancel(numerator_, denominator_, argument.denominator_, argument.numerator_);
+            if (denominator_.BigIntegerSign() < 0) {
+                numerator_.invert();
+                denominator_.invert();
+            }
+            normalizedBits_ = denominator_.bitLength();
+            return *this;
+        }
+        numerator_ *= argument.denominator_;
+        denominator_ *= argument.numerator_;
+        deferred();
+        return *this;
+    }
+
+    friend bool operator==(const LazyRational &lhs, const LazyRational &rhs);
+};
+
+inline std::istream &operator>>(std::istream &Istream, LazyRational &argument) {
+    BigInteger inputBiginteger;
+    Istream >> inputBiginteger;
+    argument = LazyRational(inputBiginteger);
+    return Istream;
+}
+
+inline std::ostream &operator<<(std::ostream &Ostream, const LazyRational &argument) {
+    return Ostream << argument.toRational();
+}
+
+inline bool operator==(const LazyRational &lhs, const LazyRational &rhs) {
+    lhs.normalize();
+    rhs.normalize();
+    return lhs.numerator_ == rhs.numerator_ && lhs.denominator_ == rhs.denominator_;
+}
+
+inline bool operator<(const LazyRational &lhs, const LazyRational &rhs) {
+    return lhs.toRational() < rhs.toRational();
+}
+
+inline bool operator>(const LazyRational &lhs, const LazyRational &rhs) {
+    return rhs < lhs;
+}
+
+inline bool operator<=(const LazyRational &lhs, const LazyRational &rhs) {
+    return !(lhs > rhs);
+}
+
+inline bool operator>=(const LazyRational &lhs, const LazyRational &rhs) {
+    return !(lhs < rhs);
+}
+
+inline bool operator!=(const LazyRational &lhs, const LazyRational &rhs) {
+    return !(lhs == rhs);
+}
+
+inline LazyRational operator+(const LazyRational &lhs, const LazyRational &rhs) {
+    LazyRational newRational(lhs);
+    newRational += rhs;
+    return newRational;
+}
+
+inline LazyRational operator-(const LazyRational &lhs, const LazyRational &rhs) {
+    LazyRational newRational(lhs);
+    newRational -= rhs;
+    return newRational;
+}
+
+inline LazyRational operator*(const LazyRational &lhs, const LazyRational &rhs) {
+    LazyRational newRational(lhs);
+    newRational *= rhs;
+    return newRational;
+}
+
+inline LazyRational operator/(const LazyRational &lhs, const LazyRational &rhs) {
+    LazyRational newRational(lhs);
+    newRational /= rhs;
+    return newRational;
+}
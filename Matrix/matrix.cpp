@@ -1,985 +1,1038 @@
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <vector>
 #include <cassert>
+// BigInteger and Rational come from the header-only BigInteger module next to this directory.
+#include "../BigInteger/biginteger.h"
 
-class BigInteger {
-private:
-    const int static number = 1e9;
-    std::vector<long long> entrails;
-    int sign;
-
-    size_t length() const { return entrails.size(); }
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RESIDUE_SIMD 1
+#endif
 
-public:
-    BigInteger(long long x) {
-        if (x < 0) {
-            sign = -1;
-            x = -x;
-        } else {
-            if (x > 0) sign = 1;
-            if (x == 0) {
-                sign = 0;
-                entrails.push_back(0);
-                return;
-            }
-        }
+constexpr unsigned long long mulMod(unsigned long long lhs, unsigned long long rhs, unsigned long long mod) {
+    return (unsigned long long) ((unsigned __int128) lhs * rhs % mod);
+}
 
-        while (x != 0) {
-            entrails.push_back(x % number);
-            x /= number;
-        }
+constexpr unsigned long long powMod(unsigned long long base, unsigned long long exponent, unsigned long long mod) {
+    unsigned long long result = 1 % mod;
+    for (base %= mod; exponent != 0; exponent >>= 1) {
+        if (exponent & 1) result = mulMod(result, base, mod);
+        base = mulMod(base, base, mod);
     }
+    return result;
+}
 
-    BigInteger() : BigInteger(0ll) {}
-
-    BigInteger(const std::string &stringInput) {
-        if (stringInput == "-0" || stringInput == "0") {
-            sign = 0;
-            entrails.push_back(0);
-            return;
-        }
-        size_t start;
-        if (stringInput[0] == '-') {
-            sign = -1;
-            start = 1;
-        } else {
-            sign = 1;
-            start = 0;
-        }
-        size_t newSize = ((stringInput.length() - start - 1) / 9) + 1;
-        entrails.resize(newSize);
-        for (size_t i = 0; i < newSize - 1; ++i) {
-            entrails[i] =
-                    std::stoll(stringInput.substr(stringInput.size() - 9 * (i + 1), 9));
+constexpr bool isPrime(unsigned long long n) {
+    if (n < 2) return false;
+    for (unsigned long long p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+        if (n % p == 0) return n == p;
+    unsigned long long odd = n - 1;
+    int twos = 0;
+    for (; odd % 2 == 0; odd /= 2) ++twos;
+    for (unsigned long long base : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+        unsigned long long x = powMod(base, odd, n);
+        if (x == 1 || x == n - 1) continue;
+        bool composite = true;
+        for (int i = 1; i < twos && composite; ++i) {
+            x = mulMod(x, x, n);
+            composite = x != n - 1;
         }
-        if ((stringInput.length() - start) % 9 != 0) {
-            entrails.back() = std::stoll(
-                    stringInput.substr(start, (stringInput.length() - start) % 9));
-        } else
-            entrails.back() = std::stoll(stringInput.substr(start, 9));
+        if (composite) return false;
     }
+    return true;
+}
 
-    int signs() const { return sign; }
+template<size_t N>
+constexpr bool is_prime = isPrime(N);
 
-    int unsignedComparison(const BigInteger &argument) const {
-        if (length() < argument.length()) return 1;
-        if (length() > argument.length()) return -1;
-        for (size_t i = length(); i > 0; --i) {
-            if (entrails[i - 1] < argument.entrails[i - 1]) return 1;
-            if (entrails[i - 1] > argument.entrails[i - 1]) return -1;
-        }
-        return 0;
-    }
+enum class SimdLevel {
+    scalar, avx2, avx512
+};
 
-    void swap(BigInteger &argument) {
-        std::swap(entrails, argument.entrails);
-        std::swap(sign, argument.sign);
-    }
+inline SimdLevel simdLevel() {
+#ifdef RESIDUE_SIMD
+    static const SimdLevel level = __builtin_cpu_supports("avx512f") ? SimdLevel::avx512 :
+                                   __builtin_cpu_supports("avx2") ? SimdLevel::avx2 : SimdLevel::scalar;
+    return level;
+#else
+    return SimdLevel::scalar;
+#endif
+}
 
-    BigInteger &operator=(const BigInteger &argument) {
-        BigInteger copy = argument;
-        swap(copy);
-        return *this;
-    }
+inline unsigned long long shoupFactor(unsigned long long factor, unsigned long long modulus) {
+    return (factor << 32) / modulus;
+}
 
-    void invert() {
-        sign *= -1;
-    }
+inline unsigned long long shoupMultiply(unsigned long long value, unsigned long long factor,
+                                        unsigned long long shoup, unsigned long long modulus) {
+    unsigned long long result = value * factor - ((value * shoup) >> 32) * modulus;
+    return result >= modulus ? result - modulus : result;
+}
 
-    const std::string toString() const {
-        std::string result;
-        std::string x;
-        if (sign == -1) result.push_back('-');
-        result += std::to_string(entrails[length() - 1]);
-        for (size_t i = length() - 1; i > 0; --i) {
-            x = std::to_string(entrails[i - 1]);
-            size_t sizeX = x.size();
-            while (sizeX < 9) {
-                result += '0';
-                sizeX++;
-            }
-            result += x;
-        }
-        return result;
+inline void subtractMultipleScalar(unsigned long long *target, const unsigned long long *source, size_t size,
+                                   unsigned long long factor, unsigned long long modulus) {
+    unsigned long long shoup = shoupFactor(factor, modulus);
+    for (size_t i = 0; i < size; ++i) {
+        unsigned long long product = shoupMultiply(source[i], factor, shoup, modulus);
+        target[i] = target[i] >= product ? target[i] - product : target[i] + modulus - product;
     }
+}
 
-    explicit operator bool() const { return sign; }
-
-    void plus(const BigInteger &argument) {
-        if (sign == 0) sign = argument.sign;
-        if (entrails.size() < argument.entrails.size())
-            entrails.resize(argument.entrails.size());
-        long long last = 0;
-        for (size_t i = 0; i < entrails.size(); ++i) {
-            long long sum = entrails[i] + last;
-            if (i < argument.entrails.size()) sum += argument.entrails[i];
-            entrails[i] = sum % number;
-            last = sum / number;
-        }
-        if (last != 0) entrails.push_back(last);
-    }
+inline void scaleScalar(unsigned long long *target, size_t size, unsigned long long factor,
+                        unsigned long long modulus) {
+    unsigned long long shoup = shoupFactor(factor, modulus);
+    for (size_t i = 0; i < size; ++i) target[i] = shoupMultiply(target[i], factor, shoup, modulus);
+}
 
-    void minus(const BigInteger &argument) {
-        if (unsignedComparison(argument) == 0) {
-            *this = 0;
-            return;
-        }
-        long long delta = 0;
-        if (unsignedComparison(argument) != 1) {
-            for (size_t i = 0; i < entrails.size(); ++i) {
-                delta = entrails[i];
-                if (i < argument.entrails.size())
-                    delta = entrails[i] - argument.entrails[i];
-                if (delta < 0) {
-                    entrails[i + 1]--;
-                    delta += number;
-                }
-                entrails[i] = delta;
-            }
+inline unsigned __int128 dotScalar(const unsigned long long *lhs, const unsigned long long *rhs, size_t size) {
+    unsigned __int128 result = 0;
+    for (size_t i = 0; i < size; ++i) result += lhs[i] * rhs[i];
+    return result;
+}
 
-        } else {
-            if (entrails.size() < argument.entrails.size())
-                entrails.resize(argument.entrails.size());
-            long long part = 0;
-            if (sign == 0) sign = -1;
-            sign = -sign;
-            for (size_t i = 0; i < entrails.size(); ++i) {
-                delta = argument.entrails[i] - entrails[i] - part;
-                if (delta < 0) {
-                    part = 1;
-                    delta += number;
-                } else
-                    part = 0;
-                entrails[i] = delta;
+inline void accumulatePanelScalar(unsigned long long *high, unsigned long long *low, size_t sumStride,
+                                  const unsigned long long *panel, size_t panelStride,
+                                  const unsigned long long *factors, size_t factorStride, size_t depth) {
+    for (size_t t = 0; t < depth; ++t) {
+        for (size_t r = 0; r < 4; ++r) {
+            unsigned long long factor = factors[r * factorStride + t];
+            for (size_t j = 0; j < 8; ++j) {
+                unsigned long long product = factor * panel[t * panelStride + j];
+                high[r * sumStride + j] += product >> 32;
+                low[r * sumStride + j] += product & 0xffffffffull;
             }
         }
     }
+}
 
-    BigInteger &operator+=(const BigInteger &argument) {
-        if (this == &argument) {
-            BigInteger copy = argument;
-            return *this += copy;
-        }
-        if (sign * argument.sign >= 0)
-            plus(argument);
-        else
-            minus(argument);
-        size_t i = entrails.size() - 1;
-        while (entrails[i] == 0 && entrails.size() > 1) {
-            entrails.pop_back();
-            --i;
-        }
-        return *this;
-    }
-
-    BigInteger &operator-=(const BigInteger &argument) {
-        if (this == &argument) {
-            BigInteger copy = argument;
-            return *this -= copy;
-        }
-        if (sign * argument.sign >= 0)
-            minus(argument);
-        else
-            plus(argument);
-        size_t i = entrails.size() - 1;
-        while (entrails[i] == 0 && entrails.size() > 1) {
-            entrails.pop_back();
-            --i;
-        }
-        return *this;
-    }
-
-    BigInteger operator-() const {
-        BigInteger newBigInteger(*this);
-        newBigInteger.sign = -sign;
-        return newBigInteger;
-    }
-
-    BigInteger &operator++() {
-        *this += 1;
-        return *this;
-    }
-
-    BigInteger operator++(int) {
-        BigInteger newBigInteger = *this;
-        ++(*this);
-        return newBigInteger;
-    }
-
-    BigInteger &operator--() {
-        *this -= 1;
-        return *this;
-    }
-
-    BigInteger operator--(int) {
-        BigInteger newBigInteger = *this;
-        --(*this);
-        return newBigInteger;
-    }
-
-    BigInteger &operator*=(const BigInteger &argument) {
-        if (this == &argument) {
-            BigInteger copy = argument;
-            return *this *= copy;
-        }
-        if (argument.sign == 0) {
-            *this = BigInteger(0ll);
-            return *this;
-        }
-        BigInteger newBigInteger;
-        long long next = 0;
-        long long temp;
-        newBigInteger.sign = sign * argument.sign;
-        newBigInteger.entrails.resize(entrails.size() + argument.entrails.size() +
-                                      1);
-        for (size_t i = 0; i < entrails.size(); ++i) {
-            for (size_t k = 0; k < argument.entrails.size() || next; ++k) {
-                temp = (newBigInteger.entrails[i + k] +
-                        entrails[i] *
-                        (k < argument.entrails.size() ? argument.entrails[k] : 0) +
-                        next);
-                newBigInteger.entrails[i + k] = temp % number;
-                next = temp / number;
-            }
-        }
-        if (next != 0) newBigInteger.entrails.push_back(next);
-
-        *this = newBigInteger;
+#ifdef RESIDUE_SIMD
+__attribute__((target("avx2")))
+inline void subtractMultipleAvx2(unsigned long long *target, const unsigned long long *source, size_t size,
+                                 unsigned long long factor, unsigned long long modulus) {
+    unsigned long long shoup = shoupFactor(factor, modulus);
+    const __m256i factors = _mm256_set1_epi64x((long long) factor);
+    const __m256i shoups = _mm256_set1_epi64x((long long) shoup);
+    const __m256i moduli = _mm256_set1_epi64x((long long) modulus);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256i value = _mm256_loadu_si256((const __m256i *) (source + i));
+        __m256i quotient = _mm256_srli_epi64(_mm256_mul_epu32(value, shoups), 32);
+        __m256i product = _mm256_sub_epi64(_mm256_mul_epu32(value, factors), _mm256_mul_epu32(quotient, moduli));
+        product = _mm256_sub_epi64(product, _mm256_andnot_si256(_mm256_cmpgt_epi64(moduli, product), moduli));
+        __m256i current = _mm256_loadu_si256((const __m256i *) (target + i));
+        __m256i borrow = _mm256_and_si256(_mm256_cmpgt_epi64(product, current), moduli);
+        _mm256_storeu_si256((__m256i *) (target + i),
+                            _mm256_add_epi64(_mm256_sub_epi64(current, product), borrow));
+    }
+    subtractMultipleScalar(target + i, source + i, size - i, factor, modulus);
+}
 
-        size_t i = entrails.size() - 1;
-        while (entrails[i] == 0 && entrails.size() > 1) {
-            entrails.pop_back();
-            --i;
-        }
+__attribute__((target("avx2")))
+inline void scaleAvx2(unsigned long long *target, size_t size, unsigned long long factor,
+                      unsigned long long modulus) {
+    unsigned long long shoup = shoupFactor(factor, modulus);
+    const __m256i factors = _mm256_set1_epi64x((long long) factor);
+    const __m256i shoups = _mm256_set1_epi64x((long long) shoup);
+    const __m256i moduli = _mm256_set1_epi64x((long long) modulus);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256i value = _mm256_loadu_si256((const __m256i *) (target + i));
+        __m256i quotient = _mm256_srli_epi64(_mm256_mul_epu32(value, shoups), 32);
+        __m256i product = _mm256_sub_epi64(_mm256_mul_epu32(value, factors), _mm256_mul_epu32(quotient, moduli));
+        product = _mm256_sub_epi64(product, _mm256_andnot_si256(_mm256_cmpgt_epi64(moduli, product), moduli));
+        _mm256_storeu_si256((__m256i *) (target + i), product);
+    }
+    scaleScalar(target + i, size - i, factor, modulus);
+}
 
-        return *this;
-    }
+__attribute__((target("avx2")))
+inline unsigned __int128 dotAvx2(const unsigned long long *lhs, const unsigned long long *rhs, size_t size) {
+    const __m256i lowMask = _mm256_set1_epi64x(0xffffffffll);
+    __m256i high = _mm256_setzero_si256();
+    __m256i low = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256i product = _mm256_mul_epu32(_mm256_loadu_si256((const __m256i *) (lhs + i)),
+                                           _mm256_loadu_si256((const __m256i *) (rhs + i)));
+        high = _mm256_add_epi64(high, _mm256_srli_epi64(product, 32));
+        low = _mm256_add_epi64(low, _mm256_and_si256(product, lowMask));
+    }
+    unsigned long long highs[4];
+    unsigned long long lows[4];
+    _mm256_storeu_si256((__m256i *) highs, high);
+    _mm256_storeu_si256((__m256i *) lows, low);
+    unsigned __int128 result = dotScalar(lhs + i, rhs + i, size - i);
+    for (size_t k = 0; k < 4; ++k) result += ((unsigned __int128) highs[k] << 32) + lows[k];
+    return result;
+}
 
-    static void multiply(const BigInteger &withZeroes, BigInteger &result,
-                         const BigInteger &argument, size_t zer) {
-        long long multi;
-        long long last = 0;
-        result.entrails.resize(argument.entrails.size() + zer - 1, 0);
-        for (size_t i = 0; i < argument.entrails.size(); ++i) {
-            multi = argument.entrails[i] * withZeroes.entrails[zer - 1];
-            result.entrails[i + zer - 1] = (multi + last) % number;
-            last = (multi + last) / number;
+__attribute__((target("avx2")))
+inline void accumulatePanelAvx2(unsigned long long *high, unsigned long long *low, size_t sumStride,
+                                const unsigned long long *panel, size_t panelStride,
+                                const unsigned long long *factors, size_t factorStride, size_t depth) {
+    const __m256i lowMask = _mm256_set1_epi64x(0xffffffffll);
+    for (size_t h = 0; h < 8; h += 4) {
+        __m256i highs[4];
+        __m256i lows[4];
+        for (size_t r = 0; r < 4; ++r) {
+            highs[r] = _mm256_loadu_si256((const __m256i *) (high + r * sumStride + h));
+            lows[r] = _mm256_loadu_si256((const __m256i *) (low + r * sumStride + h));
         }
-        result.sign = 1;
-        if (last != 0) result.entrails.push_back(last);
-    }
-
-    void twoPart() {
-        entrails[0] >>= 1;
-        for (size_t index = 1; index < entrails.size(); ++index) {
-            if (entrails[index] & 1) {
-                entrails[index - 1] += number / 2;
+        for (size_t t = 0; t < depth; ++t) {
+            __m256i values = _mm256_loadu_si256((const __m256i *) (panel + t * panelStride + h));
+            for (size_t r = 0; r < 4; ++r) {
+                __m256i product = _mm256_mul_epu32(values, _mm256_set1_epi64x((long long) factors[r * factorStride + t]));
+                highs[r] = _mm256_add_epi64(highs[r], _mm256_srli_epi64(product, 32));
+                lows[r] = _mm256_add_epi64(lows[r], _mm256_and_si256(product, lowMask));
             }
-            entrails[index] >>= 1;
         }
-        size_t i = entrails.size() - 1;
-        while (entrails[i] == 0 && entrails.size() > 1) {
-            entrails.pop_back();
-            --i;
+        for (size_t r = 0; r < 4; ++r) {
+            _mm256_storeu_si256((__m256i *) (high + r * sumStride + h), highs[r]);
+            _mm256_storeu_si256((__m256i *) (low + r * sumStride + h), lows[r]);
         }
-        if (entrails.size() == 1 && entrails[0] == 0)sign = 0;
-
     }
-
-
-    static void reduction(BigInteger &num, BigInteger &den);
-
-
-    BigInteger &operator/=(const BigInteger &argument);
-
-    BigInteger &operator%=(const BigInteger &argument);
-
-    friend std::ostream &operator<<(std::ostream &Ostream,
-                                    const BigInteger &argument);
-};
-
-std::istream &operator>>(std::istream &Istream, BigInteger &argument) {
-    std::string inputString;
-    Istream >> inputString;
-    argument = BigInteger(inputString);
-    return Istream;
-}
-
-std::ostream &operator<<(std::ostream &Ostream, const BigInteger &argument) {
-    bool zero = false;
-    if (argument.signs() == -1) Ostream << '-';
-    if (argument.entrails.size() == 1) {
-        Ostream << argument.entrails[0];
-        return Ostream;
-    }
-    for (size_t i = argument.length(); i > 0; i--) {
-        if (argument.entrails[i - 1] == 0 && zero) Ostream << "000000000";
-        if (argument.entrails[i - 1] != 0) {
-            long long gran = 1e8;
-            if (zero) {
-                while (argument.entrails[i - 1] / gran == 0) {
-                    Ostream << '0';
-                    gran /= 10;
-                }
-            }
-            zero = true;
-            Ostream << argument.entrails[i - 1];
-        }
-    }
-    return Ostream;
 }
 
-BigInteger operator+(const BigInteger &argument1, const BigInteger &argument2) {
-    BigInteger newBigInteger(argument1);
-    newBigInteger += argument2;
-    return newBigInteger;
+// The unmasked forms of these intrinsics pass an undefined merge source to the builtin, which g++ reports as a
+// maybe-uninitialized read. The zero-masked forms with every lane selected compile to the same instructions.
+__attribute__((target("avx512f")))
+inline void subtractMultipleAvx512(unsigned long long *target, const unsigned long long *source, size_t size,
+                                   unsigned long long factor, unsigned long long modulus) {
+    unsigned long long shoup = shoupFactor(factor, modulus);
+    const __m512i factors = _mm512_set1_epi64((long long) factor);
+    const __m512i shoups = _mm512_set1_epi64((long long) shoup);
+    const __m512i moduli = _mm512_set1_epi64((long long) modulus);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m512i value = _mm512_loadu_si512(source + i);
+        __m512i quotient = _mm512_maskz_srli_epi64(0xff, _mm512_maskz_mul_epu32(0xff, value, shoups), 32);
+        __m512i product = _mm512_sub_epi64(_mm512_maskz_mul_epu32(0xff, value, factors),
+                                           _mm512_maskz_mul_epu32(0xff, quotient, moduli));
+        product = _mm512_maskz_min_epu64(0xff, product, _mm512_sub_epi64(product, moduli));
+        __m512i difference = _mm512_sub_epi64(_mm512_loadu_si512(target + i), product);
+        _mm512_storeu_si512(target + i, _mm512_maskz_min_epu64(0xff, difference, _mm512_add_epi64(difference, moduli)));
+    }
+    subtractMultipleScalar(target + i, source + i, size - i, factor, modulus);
 }
 
-BigInteger operator-(const BigInteger &argument1, const BigInteger &argument2) {
-    BigInteger newBigInteger(argument1);
-    newBigInteger -= argument2;
-    return newBigInteger;
+__attribute__((target("avx512f")))
+inline void scaleAvx512(unsigned long long *target, size_t size, unsigned long long factor,
+                        unsigned long long modulus) {
+    unsigned long long shoup = shoupFactor(factor, modulus);
+    const __m512i factors = _mm512_set1_epi64((long long) factor);
+    const __m512i shoups = _mm512_set1_epi64((long long) shoup);
+    const __m512i moduli = _mm512_set1_epi64((long long) modulus);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m512i value = _mm512_loadu_si512(target + i);
+        __m512i quotient = _mm512_maskz_srli_epi64(0xff, _mm512_maskz_mul_epu32(0xff, value, shoups), 32);
+        __m512i product = _mm512_sub_epi64(_mm512_maskz_mul_epu32(0xff, value, factors),
+                                           _mm512_maskz_mul_epu32(0xff, quotient, moduli));
+        _mm512_storeu_si512(target + i, _mm512_maskz_min_epu64(0xff, product, _mm512_sub_epi64(product, moduli)));
+    }
+    scaleScalar(target + i, size - i, factor, modulus);
 }
 
-BigInteger operator*(const BigInteger &argument1, const BigInteger &argument2) {
-    BigInteger newBigInteger(argument1);
-    newBigInteger *= argument2;
-    // std::cerr << (argument1) << " " << "*" << " " << (argument2) << " =" <<
-    // newBigInteger << std::endl;
-    return newBigInteger;
+__attribute__((target("avx512f")))
+inline unsigned __int128 dotAvx512(const unsigned long long *lhs, const unsigned long long *rhs, size_t size) {
+    const __m512i lowMask = _mm512_set1_epi64(0xffffffffll);
+    __m512i high = _mm512_setzero_si512();
+    __m512i low = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m512i product = _mm512_maskz_mul_epu32(0xff, _mm512_loadu_si512(lhs + i), _mm512_loadu_si512(rhs + i));
+        high = _mm512_add_epi64(high, _mm512_maskz_srli_epi64(0xff, product, 32));
+        low = _mm512_add_epi64(low, _mm512_and_si512(product, lowMask));
+    }
+    unsigned long long highs[8];
+    unsigned long long lows[8];
+    _mm512_storeu_si512(highs, high);
+    _mm512_storeu_si512(lows, low);
+    unsigned __int128 result = dotScalar(lhs + i, rhs + i, size - i);
+    for (size_t k = 0; k < 8; ++k) result += ((unsigned __int128) highs[k] << 32) + lows[k];
+    return result;
 }
-
-bool operator==(const BigInteger &argument1, const BigInteger &argument2) {
-    if ((argument1.unsignedComparison(argument2) == 0) &&
-        (argument1.signs() == argument2.signs()))
-        return true;
-    else
-        return false;
+__attribute__((target("avx512f")))
+inline void accumulatePanelAvx512(unsigned long long *high, unsigned long long *low, size_t sumStride,
+                                  const unsigned long long *panel, size_t panelStride,
+                                  const unsigned long long *factors, size_t factorStride, size_t depth) {
+    const __m512i lowMask = _mm512_set1_epi64(0xffffffffll);
+    __m512i highs[4];
+    __m512i lows[4];
+    for (size_t r = 0; r < 4; ++r) {
+        highs[r] = _mm512_loadu_si512(high + r * sumStride);
+        lows[r] = _mm512_loadu_si512(low + r * sumStride);
+    }
+    for (size_t t = 0; t < depth; ++t) {
+        __m512i values = _mm512_loadu_si512(panel + t * panelStride);
+        for (size_t r = 0; r < 4; ++r) {
+            __m512i product = _mm512_maskz_mul_epu32(0xff, values,
+                                                     _mm512_set1_epi64((long long) factors[r * factorStride + t]));
+            highs[r] = _mm512_add_epi64(highs[r], _mm512_maskz_srli_epi64(0xff, product, 32));
+            lows[r] = _mm512_add_epi64(lows[r], _mm512_and_si512(product, lowMask));
+        }
+    }
+    for (size_t r = 0; r < 4; ++r) {
+        _mm512_storeu_si512(high + r * sumStride, highs[r]);
+        _mm512_storeu_si512(low + r * sumStride, lows[r]);
+    }
 }
-
-bool operator<(const BigInteger &argument1, const BigInteger &argument2) {
-    if (argument1.signs() < argument2.signs()) return true;
-    if (argument1.signs() > argument2.signs()) return false;
-    if (argument1.signs() == 0) return false;
-
-    return ((argument1.signs() == argument1.unsignedComparison(argument2)));
+#endif
+
+inline void subtractMultipleRow(unsigned long long *target, const unsigned long long *source, size_t size,
+                                unsigned long long factor, unsigned long long modulus) {
+#ifdef RESIDUE_SIMD
+    if (simdLevel() == SimdLevel::avx512) return subtractMultipleAvx512(target, source, size, factor, modulus);
+    if (simdLevel() == SimdLevel::avx2) return subtractMultipleAvx2(target, source, size, factor, modulus);
+#endif
+    subtractMultipleScalar(target, source, size, factor, modulus);
 }
 
-bool operator>(const BigInteger &argument1, const BigInteger &argument2) {
-    return argument2 < argument1;
+inline void scaleRow(unsigned long long *target, size_t size, unsigned long long factor,
+                     unsigned long long modulus) {
+#ifdef RESIDUE_SIMD
+    if (simdLevel() == SimdLevel::avx512) return scaleAvx512(target, size, factor, modulus);
+    if (simdLevel() == SimdLevel::avx2) return scaleAvx2(target, size, factor, modulus);
+#endif
+    scaleScalar(target, size, factor, modulus);
 }
 
-bool operator<=(const BigInteger &argument1, const BigInteger &argument2) {
-    return !(argument1 > argument2);
+inline unsigned __int128 dotRow(const unsigned long long *lhs, const unsigned long long *rhs, size_t size) {
+#ifdef RESIDUE_SIMD
+    if (simdLevel() == SimdLevel::avx512) return dotAvx512(lhs, rhs, size);
+    if (simdLevel() == SimdLevel::avx2) return dotAvx2(lhs, rhs, size);
+#endif
+    return dotScalar(lhs, rhs, size);
 }
 
-bool operator>=(const BigInteger &argument1, const BigInteger &argument2) {
-    return !(argument1 < argument2);
+inline void accumulatePanel(unsigned long long *high, unsigned long long *low, size_t sumStride,
+                            const unsigned long long *panel, size_t panelStride,
+                            const unsigned long long *factors, size_t factorStride, size_t depth) {
+#ifdef RESIDUE_SIMD
+    if (simdLevel() == SimdLevel::avx512)
+        return accumulatePanelAvx512(high, low, sumStride, panel, panelStride, factors, factorStride, depth);
+    if (simdLevel() == SimdLevel::avx2)
+        return accumulatePanelAvx2(high, low, sumStride, panel, panelStride, factors, factorStride, depth);
+#endif
+    accumulatePanelScalar(high, low, sumStride, panel, panelStride, factors, factorStride, depth);
 }
 
-bool operator!=(const BigInteger &argument1, const BigInteger &argument2) {
-    return !(argument1 == argument2);
-}
+template<size_t N>
+class Residue {
+private:
+    static constexpr bool montgomery = N % 2 == 1;
 
-BigInteger &BigInteger::operator/=(const BigInteger &argument) {
-    if (this == &argument) {
-        BigInteger copy = argument;
-        return *this /= copy;
+    static constexpr unsigned long long wordInverse() {
+        unsigned long long result = N;
+        for (int i = 0; i < 5; ++i) result *= 2 - N * result;
+        return result;
     }
-    BigInteger answer;
-    if (sign == 0) {
-        answer = 0;
-        *this = answer;
-        return *this;
+
+    static constexpr unsigned long long modulusInverse = wordInverse();
+    static constexpr unsigned long long radixSquare = mulMod(-(unsigned long long) N % N, -(unsigned long long) N % N, N);
+
+    static constexpr unsigned long long reduce(unsigned __int128 value) {
+        unsigned long long quotient = (unsigned long long) value * modulusInverse;
+        unsigned long long high = (unsigned long long) (value >> 64);
+        unsigned long long correction = (unsigned long long) (((unsigned __int128) quotient * N) >> 64);
+        return high >= correction ? high - correction : high - correction + N;
     }
-    if (unsignedComparison(argument) == 1) {
-        answer = 0;
-        *this = answer;
-        return *this;
+
+    static constexpr unsigned long long multiply(unsigned long long lhs, unsigned long long rhs) {
+        if constexpr (montgomery)
+            return reduce((unsigned __int128) lhs * rhs);
+        else
+            return mulMod(lhs, rhs, N);
     }
-    BigInteger newBigInteger;
-    size_t zer = entrails.size() - argument.entrails.size() + 1;
-    answer.entrails.resize(zer);
-    newBigInteger.entrails.resize(zer, 0);
-    answer.sign = sign * argument.sign;
-    sign = 1;
-
-    for (size_t i = entrails.size() - argument.entrails.size() + 1; i > 0; --i) {
-        //if (entrails[i-1] < argument){
-        //  answer.entrails[i - 1] = 0;
-        //entrails[i + argument.entrails.size() - 2] +=
-        //}
-        long long left = -1;
-        long long right = 1e9;
-        BigInteger result;
-        while (left < right - 1) {
-            long long median = (left + right) / 2;
-            newBigInteger.entrails[i - 1] = median;
-            multiply(newBigInteger, result, argument, zer);
-            if (result <= *this) left = median;
-            if (result > *this) right = median;
-        }
-        newBigInteger.entrails[i - 1] = left;
-        multiply(newBigInteger, result, argument, zer);
-        // std::cout << "this: " << *this << "  result:" << result << std::endl;
-        *this -= result;
-        --zer;
-        answer.entrails[i - 1] = left;
-        newBigInteger.entrails[i - 1] = 0;
-        if (*this == 0) break;
-    }
-    *this = answer;
-    size_t i = entrails.size() - 1;
-    while (entrails[i] == 0 && entrails.size() > 1) {
-        entrails.pop_back();
-        --i;
-    }
-    return *this;
-}
-
-BigInteger operator/(const BigInteger &argument1, const BigInteger &argument2) {
-    BigInteger newBigInteger(argument1);
-    newBigInteger /= argument2;
-    // std::cerr << argument1 << " " << "/" << " " << argument2 << " =" <<
-    // newBigInteger << std::endl;
-    return newBigInteger;
-}
-
-BigInteger &BigInteger::operator%=(const BigInteger &argument) {
-    BigInteger a = ((*this / argument) * argument);
-    *this -= a;
-    return *this;
-}
-
-BigInteger operator%(const BigInteger &argument1, const BigInteger &argument2) {
-    BigInteger newBigInteger(argument1);
-    newBigInteger %= argument2;
-    return newBigInteger;
-}
-
-
-void BigInteger::reduction(BigInteger &num, BigInteger &den) {
-    while (num.entrails[0] % 2 == 0 && den.entrails[0] % 2 == 0) {
-        num.twoPart();
-        den.twoPart();
-    }
-    BigInteger a = num;
-    BigInteger b = den;
-    while (a != 0 && b != 0) {
-        while (a.entrails[0] % 2 == 0) a.twoPart();
-        while (b.entrails[0] % 2 == 0) b.twoPart();
-        //std::cout << "into" << std::endl;
-        if (a > b) {
-            a -= b;
-            a.twoPart();
-        } else {
-            b -= a;
-            b.twoPart();
-        }
 
+    static unsigned long long encode(unsigned long long value) {
+        if constexpr (montgomery)
+            return multiply(value % N, radixSquare);
+        else
+            return value % N;
     }
-    if (a == 0)std::swap(a, b);
-    num /= a;
-    den /= a;
-}
 
-class Rational {
-private:
-    BigInteger numerator;
-    BigInteger denominator;
-    int sign;
+    static unsigned long long *words(Residue *values) {
+        return reinterpret_cast<unsigned long long *>(values);
+    }
 
-public:
-    Rational(int x) {
-        if (x == 0) {
-            sign = 0;
-        }
-        if (x > 0) {
-            sign = 1;
-        }
-        if (x < 0) {
-            sign = -1;
-            x = -x;
-        }
-        numerator = x;
-        denominator = 1;
+    static const unsigned long long *words(const Residue *values) {
+        return reinterpret_cast<const unsigned long long *>(values);
     }
 
+    unsigned long long number;
 
-    Rational(const BigInteger &up, const BigInteger &down = 1) : numerator(up), denominator(down) {
-        sign = up.signs() * down.signs();
-        if (up.signs() == -1) numerator.invert();
-        if (down.signs() == -1) denominator.invert();
-        up.reduction(numerator, denominator);
-    }
+public:
+    Residue() = default;
 
+    Residue(long long x) {
+        unsigned long long magnitude = x < 0 ? 0 - (unsigned long long) x : x;
+        number = magnitude % N;
+        if (x < 0 && number != 0) number = N - number;
+        number = encode(number);
+    }
 
-    Rational() : Rational(0) {}
+    explicit operator int() const { return int(value()); }
 
-    int signs() const { return sign; }
+    unsigned long long value() const {
+        if constexpr (montgomery)
+            return reduce(number);
+        else
+            return number;
+    }
 
-    Rational operator-() const {
-        Rational newRational(*this);
-        newRational.sign = -sign;
-        return newRational;
+    Residue &operator+=(const Residue &argument) {
+        number += argument.number;
+        if (number < argument.number || number >= N) number -= N;
+        return *this;
     }
 
-    const std::string toString() const {
-        //-
-        std::string result;
-        if (sign == -1) result.push_back('-');
-        result += numerator.toString();
-        if (denominator != 1) {
-            result += '/';
-            result += denominator.toString();
-        }
-        return result;
+    Residue &operator-=(const Residue &argument) {
+        if (number < argument.number) number += N;
+        number -= argument.number;
+        return *this;
     }
 
-    int unsignedComparison(const Rational &argument) const {
-        BigInteger up = numerator * argument.denominator;
-        BigInteger down = denominator * argument.numerator;
-        return up.unsignedComparison(down);
+    Residue &operator*=(const Residue &argument) {
+        number = multiply(number, argument.number);
+        return *this;
     }
 
-    void plus(const Rational &argument) {
-        numerator =
-                numerator * argument.denominator + denominator * argument.numerator;
-        denominator *= argument.denominator;
+    Residue operator-() const {
+        Residue<N> newResidue(*this);
+        newResidue.number = number == 0 ? 0 : N - number;
+        return newResidue;
     }
 
-    void minus(const Rational &argument) {
-        int a = unsignedComparison(argument);
-        if (a == 0) {
-            *this = 0;
-            return;
-        }
-        BigInteger up = numerator * argument.denominator;
-        BigInteger down = denominator * argument.numerator;
-        if (a == -1) {
-            numerator = up - down;
-            denominator *= argument.denominator;
-        }
-        if (a == 1) {
-            sign = -sign;
-            numerator = down - up;
-            denominator *= argument.denominator;
+    Residue pow(size_t K) const;
+
+    Residue inverse() const {
+        unsigned long long lhs = value();
+        unsigned long long rhs = N;
+        __int128 lhsFactor = 1;
+        __int128 rhsFactor = 0;
+        while (rhs != 0) {
+            unsigned long long quotient = lhs / rhs;
+            lhs -= quotient * rhs;
+            lhsFactor -= (__int128) quotient * rhsFactor;
+            std::swap(lhs, rhs);
+            std::swap(lhsFactor, rhsFactor);
         }
+        if (lhsFactor < 0) lhsFactor += N;
+        Residue result;
+        result.number = encode((unsigned long long) lhsFactor);
+        return result;
     }
 
-    Rational &operator+=(const Rational &argument) {
-        if (this == &argument) {
-            Rational copy = argument;
-            return *this += copy;
-        }
-        if (sign * argument.sign >= 0) {
-            plus(argument);
-            if (sign == 0) sign = argument.sign;
+    static constexpr bool packed = N < (1ull << 32);
 
+    static void subtractMultiple(Residue *target, const Residue *source, size_t size, const Residue &factor) {
+        if constexpr (packed) {
+            subtractMultipleRow(words(target), words(source), size, factor.value(), N);
         } else {
-            minus(argument);
+            for (size_t i = 0; i < size; ++i) target[i] -= source[i] * factor;
         }
-        numerator.reduction(numerator, denominator);
-        return *this;
     }
 
-    Rational &operator-=(const Rational &argument) {
-        if (this == &argument) {
-            Rational copy = argument;
-            return *this -= copy;
-        }
-        if (sign * argument.sign >= 0) {
-            minus(argument);
-            if (sign == 0) sign = -argument.sign;
-
+    static void scale(Residue *target, size_t size, const Residue &factor) {
+        if constexpr (packed) {
+            scaleRow(words(target), size, factor.value(), N);
         } else {
-            plus(argument);
+            for (size_t i = 0; i < size; ++i) target[i] *= factor;
         }
-        numerator.reduction(numerator, denominator);
-        return *this;
     }
 
-    Rational &operator*=(const Rational &argument) {
-        if (this == &argument) {
-            Rational copy = argument;
-            return *this *= copy;
+    static Residue dot(const Residue *lhs, const Residue *rhs, size_t size) {
+        Residue result(0);
+        if constexpr (packed) {
+            unsigned long long sum = (unsigned long long) (dotRow(words(lhs), words(rhs), size) % N);
+            result.number = montgomery ? reduce(sum) : sum;
+        } else {
+            for (size_t i = 0; i < size; ++i) result += lhs[i] * rhs[i];
         }
-        sign *= argument.sign;
-        numerator *= argument.numerator;
-        denominator *= argument.denominator;
-        numerator.reduction(numerator, denominator);
-        return *this;
+        return result;
     }
 
-    Rational &operator/=(const Rational &argument) {
-        if (this == &argument) {
-            Rational copy = argument;
-            return *this /= copy;
+    static void multiplyPacked(const Residue *lhs, const Residue *rhs, Residue *result, size_t rows, size_t depth,
+                               size_t columns, size_t rowTile, size_t depthTile) {
+        size_t width = (columns + 7) / 8 * 8;
+        size_t height = (rows + 3) / 4 * 4;
+        std::vector<unsigned long long> panel(depth * width, 0);
+        std::vector<unsigned long long> factors(height * depth, 0);
+        std::vector<unsigned long long> high(height * width, 0);
+        std::vector<unsigned long long> low(height * width, 0);
+        for (size_t t = 0; t < depth; ++t)
+            std::copy(words(rhs + t * columns), words(rhs + (t + 1) * columns), panel.begin() + t * width);
+        std::copy(words(lhs), words(lhs + rows * depth), factors.begin());
+        for (size_t t = 0; t < depth; t += depthTile) {
+            size_t span = std::min(depthTile, depth - t);
+            for (size_t block = 0; block < height; block += rowTile) {
+                size_t blockEnd = std::min(height, block + rowTile);
+                for (size_t j = 0; j < width; j += 8)
+                    for (size_t i = block; i < blockEnd; i += 4)
+                        accumulatePanel(high.data() + i * width + j, low.data() + i * width + j, width,
+                                        panel.data() + t * width + j, width, factors.data() + i * depth + t, depth,
+                                        span);
+            }
+        }
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < columns; ++j) {
+                unsigned __int128 sum = ((unsigned __int128) high[i * width + j] << 32) + low[i * width + j];
+                unsigned long long residue = (unsigned long long) (sum % N);
+                result[i * columns + j].number = montgomery ? reduce(residue) : residue;
+            }
         }
-        sign *= argument.sign;
-        numerator *= argument.denominator;
-        denominator *= argument.numerator;
-        numerator.reduction(numerator, denominator);
-        return *this;
     }
 
-    std::string asDecimal(size_t precision) const {
-        Rational newRational = *this;
-        std::string result;
-        std::string dopResult;
-        if (sign == -1) result += '-';
-        BigInteger push = 1e9;
-        BigInteger pushBigInteger;
-        pushBigInteger = newRational.numerator / newRational.denominator;
-        result += pushBigInteger.toString();
-        result += '.';
-        ///bool op = 1;
-        newRational.numerator -= pushBigInteger * denominator;
-        newRational.numerator *= push;
-        while (precision > 0) {
-            pushBigInteger = newRational.numerator / newRational.denominator;
-            newRational.numerator -= pushBigInteger * denominator;
-            newRational.numerator *= push;
-            if (precision > pushBigInteger.toString().size()) {
-                if (pushBigInteger == 0) {
-                    result += "000000000";
-                    precision -= 9;
-                } else {
-                    std::string part = pushBigInteger.toString();
-                    size_t n = part.length();
-                    while (n < 9) {
-                        result += '0';
-                        n++;
-                    }
-                    result += pushBigInteger.toString();
-                    precision -= pushBigInteger.toString().size();
-                }
-
-            } else {
-                result += pushBigInteger.toString().substr(0, precision);
-                break;
-            }
+    static void batchInvert(std::vector<Residue> &values) {
+        std::vector<Residue> prefix(values.size());
+        Residue product(1);
+        for (size_t i = 0; i < values.size(); ++i) {
+            prefix[i] = product;
+            if (values[i].number != 0) product *= values[i];
+        }
+        product = product.inverse();
+        for (size_t i = values.size(); i > 0; --i) {
+            if (values[i - 1].number == 0) continue;
+            Residue inverted = product * prefix[i - 1];
+            product *= values[i - 1];
+            values[i - 1] = inverted;
         }
+    }
 
-        return result;
+    Residue &operator/=(const Residue &argument) {
+        static_assert(is_prime<N>);
+        *this *= argument.inverse();
+        return *this;
     }
 
-    explicit operator double() { return std::stod(asDecimal(30)); }
+    bool equal(const Residue &argument) const {
+        return number == argument.number;
+    }
 
-    friend std::ostream &operator<<(std::ostream &Ostream,
-                                    const Rational &argument);
+    unsigned long long num() const {
+        return value();
+    }
 };
 
-std::istream &operator>>(std::istream &Istream, Rational &argument) {
-    BigInteger inputBiginteger;
-    Istream >> inputBiginteger;
-    argument = Rational(inputBiginteger);
-    return Istream;
-}
-
-std::ostream &operator<<(std::ostream &Ostream, const Rational &argument) {
-    if (argument.sign == -1) Ostream << '-';
-    if (argument.denominator == 1)
-        Ostream << argument.numerator;
-    else
-        Ostream << argument.numerator << "/" << argument.denominator;
+template<size_t N>
+std::ostream &operator<<(std::ostream &Ostream, Residue<N> input) {
+    Ostream << input.num();
     return Ostream;
 }
 
-bool operator==(const Rational &argument1, const Rational &argument2) {
-    if ((argument1.signs() == argument2.signs()) && (argument1.unsignedComparison(argument2) == 0))
-        return true;
-    else
-        return false;
+template<size_t N>
+bool operator==(const Residue<N> &argument1, const Residue<N> &argument2) {
+    return argument1.equal(argument2);
 }
 
-bool operator<(const Rational &argument1, const Rational &argument2) {
-    if (argument1.signs() < argument2.signs()) return true;
-    if (argument1.signs() > argument2.signs()) return false;
-    if (argument1.signs() == 0) return false;
-
-    // std::cerr << (argument1) << " " << "<" << " " << (argument2) << " =" <<
-    // ((argument1.signs() == argument1.unsignedComparison(argument2))) <<
-    // std::endl;
-    return ((argument1.signs() == argument1.unsignedComparison(argument2)));
+template<size_t N>
+bool operator!=(const Residue<N> &argument1, const Residue<N> &argument2) {
+    return !(argument1 == argument2);
 }
 
-bool operator>(const Rational &argument1, const Rational &argument2) {
-    // std::cerr << (argument1) << " " << ">" << " " << (argument2) << " =" <<
-    // (argument2 < argument1) << std::endl;
-    return argument2 < argument1;
+template<size_t N>
+Residue<N> operator+(const Residue<N> &argument1, const Residue<N> &argument2) {
+    Residue<N> newResidue = argument1;
+    newResidue += argument2;
+    return newResidue;
 }
 
-bool operator<=(const Rational &argument1, const Rational &argument2) {
-    // std::cerr << (argument1) << " " << ">=" << " " << (argument2) << " =" <<
-    // (!(argument1 > argument2)) << std::endl;
-    return !(argument1 > argument2);
+template<size_t N>
+Residue<N> operator-(const Residue<N> &argument1, const Residue<N> &argument2) {
+    Residue<N> newResidue = argument1;
+    newResidue -= argument2;
+    return newResidue;
 }
 
-bool operator>=(const Rational &argument1, const Rational &argument2) {
-    // std::cerr << (argument1) << " " << ">=" << " " << (argument2) << " =" <<
-    // (!(argument1 < argument2)) << std::endl;
-    return !(argument1 < argument2);
+template<size_t N>
+Residue<N> operator*(const Residue<N> &argument1, const Residue<N> &argument2) {
+    Residue<N> newResidue = argument1;
+    newResidue *= argument2;
+    return newResidue;
 }
 
-bool operator!=(const Rational &argument1, const Rational &argument2) {
-    // std::cerr << (argument1) << " " << "!=" << " " << (argument2) << " =" <<
-    // (!(argument1 == argument2)) << std::endl;
-
-    return !(argument1 == argument2);
+template<size_t N>
+Residue<N> operator/(const Residue<N> &argument1, const Residue<N> &argument2) {
+    Residue<N> newResidue = argument1;
+    newResidue /= argument2;
+    return newResidue;
 }
 
-Rational operator+(const Rational &argument1, const Rational &argument2) {
-    Rational newRational(argument1);
-    newRational += argument2;
-
-    // std::cerr << (argument1) << " " << "+" << " " << (argument2) << " =" <<
-    // newRational << std::endl;
-    return newRational;
+template<size_t N>
+Residue<N> Residue<N>::pow(size_t K) const {
+    Residue result(1);
+    for (Residue base = *this; K != 0; K >>= 1) {
+        if (K & 1) result *= base;
+        base *= base;
+    }
+    return result;
 }
 
-Rational operator-(const Rational &argument1, const Rational &argument2) {
-    Rational newRational(argument1);
-    newRational -= argument2;
-
-    // std::cerr << (argument1) << " " << "-" << " " << (argument2) << " =" <<
-    // newRational << std::endl;
-    return newRational;
-}
+static_assert(sizeof(Residue<997>) == sizeof(unsigned long long));
 
-Rational operator*(const Rational &argument1, const Rational &argument2) {
-    Rational newRational(argument1);
-    newRational *= argument2;
+template<typename Field>
+class MatrixSlice {
+private:
+    Field *elements;
+    size_t count;
+    size_t step;
 
-    // std::cerr << (argument1) << " " << "*" << " " << (argument2) << " =" <<
-    // (newRational) << std::endl;
-    return newRational;
-}
+public:
+    MatrixSlice(Field *elements, size_t count, size_t step = 1) : elements(elements), count(count), step(step) {}
 
-Rational operator/(const Rational &argument1, const Rational &argument2) {
-    Rational newRational(argument1);
-    newRational /= argument2;
+    Field &operator[](size_t i) const { return elements[i * step]; }
 
-    // std::cerr << (argument1) << " " << "/" << " " << (argument2) << " =" <<
-    // newRational << std::endl;
-    return newRational;
-}
+    size_t size() const { return count; }
 
-template<size_t N, size_t I>
-const bool is_prime = (I * I > N || N % I != 0) && is_prime<N, I + 1>;
+    Field *data() const { return elements; }
 
-template<size_t N>
-const bool is_prime<N, N> = true;
+    operator std::vector<std::remove_const_t<Field>>() const {
+        std::vector<std::remove_const_t<Field>> answer;
+        answer.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            answer.push_back(elements[i * step]);
+        }
+        return answer;
+    }
+};
 
-template<size_t I>
-const bool is_prime<1, I> = false;
+// Fraction-free elimination on a row-major integer block: every entry stays an exact minor of the input, so the
+// division by the previous pivot never leaves a remainder. Returns the rank and stores the determinant of the
+// block when it is square and of full rank, zero otherwise.
+size_t bareiss(BigInteger *entries, size_t rows, size_t columns, BigInteger &det) {
+    BigInteger previous = 1;
+    int sign = 1;
+    size_t rank = 0;
+    for (size_t column = 0; column < columns && rank < rows; column++) {
+        BigInteger *pivotRow = entries + rank * columns;
+        size_t nowIndex = rank;
+        while (nowIndex < rows && !entries[nowIndex * columns + column]) {
+            nowIndex++;
+        }
+        if (nowIndex == rows) continue;
+        if (nowIndex != rank) {
+            sign = -sign;
+            std::swap_ranges(pivotRow, pivotRow + columns, entries + nowIndex * columns);
+        }
+        const BigInteger &pivot = pivotRow[column];
+        bool divide = previous != BigInteger(1);
+        for (size_t i = rank + 1; i < rows; i++) {
+            BigInteger *current = entries + i * columns;
+            BigInteger factor = std::move(current[column]);
+            current[column] = 0;
+            for (size_t j = column + 1; j < columns; j++) {
+                current[j] *= pivot;
+                if (factor) current[j].subMul(factor, pivotRow[j]);
+                if (divide) current[j].divideExact(previous);
+            }
+        }
+        previous = pivot;
+        rank++;
+    }
+    det = rank == rows && rows == columns ? (sign < 0 ? -previous : previous) : BigInteger(0);
+    return rank;
+}
 
-template<size_t N>
-class Residue {
+// Fixed set of threads that repeatedly run a batch of independent tasks; the calling thread takes part in every
+// batch, so a pool of one thread runs everything inline. One batch runs at a time: a caller that finds the pool
+// busy, including a task that calls run() again, runs its batch inline instead of waiting.
+class WorkerPool {
 private:
-    long long number;
-
-public:
-    Residue() = default;
-
-    Residue(int x) {
-        if (x >= 0)
-            number = x % N;
-        else {
-            number = (N - ((-x) % N)) % N;
+    std::vector<std::thread> workers;
+    std::atomic<bool> running{false};
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    std::function<void(size_t)> task;
+    size_t count = 0;
+    std::atomic<size_t> next{0};
+    size_t generation = 0;
+    size_t active = 0;
+    bool stopping = false;
+
+    void drain() {
+        for (size_t i = next++; i < count; i = next++) {
+            task(i);
         }
     }
 
-    explicit operator int() { return number; }
+    void work() {
+        size_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+            drain();
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0) finished.notify_one();
+        }
+    }
 
-    Residue &operator+=(const Residue &argument) {
-        number += argument.number;
-        number %= N;
-        return *this;
+public:
+    explicit WorkerPool(size_t threads) {
+        for (size_t i = 1; i < threads; i++) {
+            workers.emplace_back(&WorkerPool::work, this);
+        }
     }
 
-    Residue &operator-=(const Residue &argument) {
-        number -= argument.number;
-        if (number < 0) number = N + number;
-        number %= N;
+    WorkerPool(const WorkerPool &) = delete;
 
-        return *this;
-    }
+    WorkerPool &operator=(const WorkerPool &) = delete;
 
-    Residue &operator*=(const Residue &argument) {
-        number *= argument.number;
-        number %= N;
-        return *this;
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &worker: workers) {
+            worker.join();
+        }
     }
 
-    Residue operator-() const {
-        Residue<N> newResidue(*this);
-        newResidue.number = (N - number) % N;
-        return newResidue;
+    // Pool with the given number of threads, created on first use and kept for the rest of the program.
+    static WorkerPool &shared(size_t threads) {
+        static std::mutex poolsMutex;
+        static std::map<size_t, std::unique_ptr<WorkerPool>> pools;
+        threads = std::max<size_t>(threads, 1);
+        std::lock_guard<std::mutex> lock(poolsMutex);
+        std::unique_ptr<WorkerPool> &pool = pools[threads];
+        if (!pool) pool = std::make_unique<WorkerPool>(threads);
+        return *pool;
     }
 
-    Residue pow(size_t K) const;
+    size_t size() const { return workers.size() + 1; }
 
-    Residue &operator/=(const Residue &argument) {
-        //std::cerr << N;
-        static_assert(is_prime<N, 2>);
-        *this *= argument.pow(N - 2);
-        return *this;
-    }
-
-    bool equal(const Residue &argument) const {
-        return number == argument.number;
+    void run(size_t tasks, std::function<void(size_t)> body) {
+        bool idle = false;
+        if (workers.empty() || tasks <= 1 || !running.compare_exchange_strong(idle, true)) {
+            for (size_t i = 0; i < tasks; i++) {
+                body(i);
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = std::move(body);
+            count = tasks;
+            next = 0;
+            active = workers.size();
+            generation++;
+        }
+        wake.notify_all();
+        drain();
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return active == 0; });
+        running = false;
     }
+};
 
-    long long num() {
-        return number;
-    }
+enum class PivotPolicy {
+    automatic, firstNonZero, partial, complete, smallest
 };
 
-template<size_t N>
-std::ostream &operator<<(std::ostream &Ostream, Residue<N> input) {
-    Ostream << input.num();
-    return Ostream;
+// Whether candidate makes a better pivot than current under policy. Partial and complete pivoting compare
+// magnitudes, smallest compares the size of the exact representation; fields without the corresponding notion
+// keep the first non-zero entry.
+template<typename Field>
+bool betterPivot(const Field &candidate, const Field &current, PivotPolicy policy) {
+    if constexpr (std::is_floating_point_v<Field>) {
+        if (policy == PivotPolicy::partial || policy == PivotPolicy::complete)
+            return std::abs(candidate) > std::abs(current);
+    }
+    return false;
 }
 
-template<size_t N>
-bool operator==(const Residue<N> &argument1, const Residue<N> &argument2) {
-    return argument1.equal(argument2);
+bool betterPivot(const Rational &candidate, const Rational &current, PivotPolicy policy) {
+    if (policy == PivotPolicy::smallest) {
+        return candidate.numerator().bitLength() + candidate.denominator().bitLength() <
+               current.numerator().bitLength() + current.denominator().bitLength();
+    }
+    if (policy == PivotPolicy::partial || policy == PivotPolicy::complete) {
+        Rational magnitude = candidate.BigIntegerSign() < 0 ? -candidate : candidate;
+        return magnitude.compareTo(current.BigIntegerSign() < 0 ? -current : current) > 0;
+    }
+    return false;
 }
 
-template<size_t N>
-bool operator!=(const Residue<N> &argument1, const Residue<N> &argument2) {
-    return !(argument1 == argument2);
+bool betterPivot(const BigInteger &candidate, const BigInteger &current, PivotPolicy policy) {
+    if (policy == PivotPolicy::smallest) return candidate.bitLength() < current.bitLength();
+    if (policy == PivotPolicy::partial || policy == PivotPolicy::complete) return current.compare(candidate);
+    return false;
 }
 
-template<size_t N>
-Residue<N> operator+(const Residue<N> &argument1, const Residue<N> &argument2) {
-    Residue<N> newResidue = argument1;
-    newResidue += argument2;
-    return newResidue;
+template<typename Field>
+PivotPolicy resolvePivotPolicy(PivotPolicy policy) {
+    if (policy != PivotPolicy::automatic) return policy;
+    if constexpr (std::is_floating_point_v<Field>) return PivotPolicy::partial;
+    if constexpr (std::is_same_v<Field, Rational> || std::is_same_v<Field, BigInteger>) return PivotPolicy::smallest;
+    return PivotPolicy::firstNonZero;
 }
 
-template<size_t N>
-Residue<N> operator-(const Residue<N> &argument1, const Residue<N> &argument2) {
-    Residue<N> newResidue = argument1;
-    newResidue -= argument2;
-    return newResidue;
+enum class EliminationStrategy {
+    automatic, gauss, fractionFree, multiModular
+};
+
+// Elimination over Z/p for a prime below 2^32, so the packed Residue row kernels apply. Returns the rank and the
+// determinant of the square block modulo the prime.
+size_t modularEliminate(const std::vector<BigInteger> &integers, size_t rows, size_t columns,
+                        unsigned long long prime, unsigned long long &det) {
+    std::vector<unsigned long long> entries(integers.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        entries[i] = integers[i].residue(prime);
+    }
+    det = 1;
+    size_t rank = 0;
+    for (size_t column = 0; column < columns && rank < rows; column++) {
+        unsigned long long *pivotRow = entries.data() + rank * columns;
+        size_t nowIndex = rank;
+        while (nowIndex < rows && entries[nowIndex * columns + column] == 0) {
+            nowIndex++;
+        }
+        if (nowIndex == rows) continue;
+        if (nowIndex != rank) {
+            det = prime - det;
+            std::swap_ranges(pivotRow, pivotRow + columns, entries.data() + nowIndex * columns);
+        }
+        det = mulMod(det, pivotRow[column], prime);
+        unsigned long long inverse = powMod(pivotRow[column], prime - 2, prime);
+        for (size_t i = rank + 1; i < rows; i++) {
+            unsigned long long *current = entries.data() + i * columns;
+            if (current[column] == 0) continue;
+            unsigned long long factor = mulMod(current[column], inverse, prime);
+            subtractMultipleRow(current + column, pivotRow + column, columns - column, factor, prime);
+        }
+        rank++;
+    }
+    if (rank != rows || rows != columns) det = 0;
+    return rank;
 }
 
-template<size_t N>
-Residue<N> operator*(const Residue<N> &argument1, const Residue<N> &argument2) {
-    Residue<N> newResidue = argument1;
-    newResidue *= argument2;
-    return newResidue;
+// Runs the elimination modulo enough primes that their product exceeds twice the Hadamard bound of the
+// matrix, then rebuilds the determinant by Chinese remaindering. The same bound covers every minor, so a rank
+// that dropped modulo all of the primes would need a nonzero minor divisible by their product: the largest
+// modular rank is therefore exact. Without a determinant to rebuild, a first full modular rank ends the search.
+size_t multiModular(const std::vector<BigInteger> &integers, size_t rows, size_t columns, BigInteger *det,
+                    size_t threads) {
+    size_t bits = 2;
+    for (size_t i = 0; i < rows; i++) {
+        BigInteger norm = 0;
+        for (size_t j = 0; j < columns; j++) {
+            norm.addMul(integers[i * columns + j], integers[i * columns + j]);
+        }
+        bits += (norm.bitLength() + 1) / 2;
+    }
+    std::vector<unsigned long long> primes;
+    for (unsigned long long candidate = 0xffffffffull; primes.size() * 31 < bits; candidate -= 2) {
+        if (isPrime(candidate)) primes.push_back(candidate);
+    }
+    std::vector<unsigned long long> residues(primes.size());
+    std::vector<size_t> ranks(primes.size());
+    std::atomic<bool> fullRank{false};
+    WorkerPool::shared(threads).run(primes.size(), [&](size_t k) {
+        if (det == nullptr && fullRank) return;
+        ranks[k] = modularEliminate(integers, rows, columns, primes[k], residues[k]);
+        if (ranks[k] == std::min(rows, columns)) fullRank = true;
+    });
+    size_t rank = *std::max_element(ranks.begin(), ranks.end());
+    if (det == nullptr) return rank;
+    BigInteger &value = *det;
+    value = 0;
+    BigInteger modulus = 1;
+    for (size_t k = 0; k < primes.size(); k++) {
+        unsigned long long correction = (residues[k] + primes[k] - value.residue(primes[k])) % primes[k];
+        correction = mulMod(correction, powMod(modulus.residue(primes[k]), primes[k] - 2, primes[k]), primes[k]);
+        value.addMul(modulus, BigInteger((long long) correction));
+        modulus *= BigInteger((long long) primes[k]);
+    }
+    if (modulus.compare(value + value)) value -= modulus;
+    return rank;
 }
 
+// Winograd trades multiplications for additions, which pays off as soon as a scalar product is expensive;
+// floating point is left on the blocked kernel since the extra additions cost accuracy.
+template<typename Field>
+constexpr size_t strassenCutoff = std::is_floating_point_v<Field> ? SIZE_MAX : 64;
+
 template<size_t N>
-Residue<N> operator/(const Residue<N> &argument1, const Residue<N> &argument2) {
-    Residue<N> newResidue = argument1;
-    newResidue /= argument2;
-    return newResidue;
-}
+constexpr size_t strassenCutoff<Residue<N>> = Residue<N>::packed ? 512 : 32;
+
+// Row counts from which gauss() splits the row updates of each pivot over a worker pool. Residue rows are a few
+// vector instructions each, so the batches have to be much larger than for Rational.
+template<typename Field>
+constexpr size_t parallelCutoff = 64;
 
 template<size_t N>
-Residue<N> Residue<N>::pow(size_t K) const {
-    if (K == 0) return Residue(1);
-    if (K % 2 == 1)
-        return pow(K - 1) * (*this);
-    else {
-        return pow(K / 2) * pow(K / 2);
-    }
-}
+constexpr size_t parallelCutoff<Residue<N>> = 512;
+
+template<size_t N, typename Field>
+class LUDecomposition;
 
 template<size_t N, size_t M, typename Field = Rational>
 
 class Matrix {
 private:
-    std::vector<std::vector<Field>> entrails;
+    static constexpr bool inlineStorage = N * M <= 16;
+
+    using Storage = std::conditional_t<inlineStorage, std::array<Field, N * M>, std::vector<Field>>;
+
+    Storage entrails;
+
+    static Storage filled(const Field &value) {
+        Storage storage{};
+        if constexpr (inlineStorage)
+            storage.fill(value);
+        else
+            storage.assign(N * M, value);
+        return storage;
+    }
+
+    Field *row(size_t i) { return entrails.data() + i * M; }
+
+    const Field *row(size_t i) const { return entrails.data() + i * M; }
+
+    Field eliminate(size_t columns, PivotPolicy policy);
+
+    static constexpr bool integral = std::is_same_v<Field, Rational> || std::is_same_v<Field, BigInteger>;
+
+    // Scales every row to integers and returns the product of the scale factors.
+    BigInteger integerEntries(std::vector<BigInteger> &integers) const {
+        integers.resize(N * M);
+        BigInteger scale = 1;
+        for (size_t i = 0; i < N; i++) {
+            const Field *current = row(i);
+            if constexpr (std::is_same_v<Field, Rational>) {
+                BigInteger common = 1;
+                for (size_t k = 0; k < M; k++) {
+                    const BigInteger &denominator = current[k].denominator();
+                    if (denominator != BigInteger(1)) common *= denominator / BigInteger::gcd(common, denominator);
+                }
+                for (size_t k = 0; k < M; k++) {
+                    integers[i * M + k] = current[k].numerator() * (common / current[k].denominator());
+                }
+                scale *= common;
+            } else {
+                std::copy(current, current + M, integers.begin() + i * M);
+            }
+        }
+        return scale;
+    }
+
+    static EliminationStrategy exactStrategy(EliminationStrategy strategy) {
+        if (strategy != EliminationStrategy::automatic) return strategy;
+        return std::min(N, M) >= multiModularThreshold ? EliminationStrategy::multiModular
+                                                        : EliminationStrategy::fractionFree;
+    }
+
+    template<size_t, size_t, typename>
+    friend class Matrix;
 
 public:
-    explicit Matrix(long long x) : entrails(std::vector<std::vector<Field>>(N, std::vector<Field>(M, Field(x)))) {}
+    static inline size_t strassenThreshold = strassenCutoff<Field>;
+    static inline size_t multiModularThreshold = 16;
+    static inline size_t modularThreads = std::max(1u, std::thread::hardware_concurrency());
+    static inline size_t parallelGaussThreshold = parallelCutoff<Field>;
+    static inline size_t gaussThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    explicit Matrix(long long x) : entrails(filled(Field(x))) {}
 
     Matrix() : Matrix(0) {
-        for (size_t i = 0; i < N; ++i) {
-            entrails[i][i] = Field(1);
+        for (size_t i = 0; i < std::min(N, M); ++i) {
+            row(i)[i] = Field(1);
         }
     }
 
-    Matrix(const std::vector<std::vector<Field>> &x) : entrails(x) {}
-
-    Matrix(std::initializer_list<std::vector<Field>> matrix) {
-        for (auto line: matrix) {
-            entrails.push_back(line);
+    // Rows and columns missing from x are left zero, entries beyond N x M are ignored.
+    Matrix(const std::vector<std::vector<Field>> &x) : Matrix(0) {
+        for (size_t i = 0; i < std::min(N, x.size()); ++i) {
+            std::copy(x[i].begin(), x[i].begin() + std::min(M, x[i].size()), row(i));
         }
     }
 
-    std::vector<Field> &operator[](size_t i) { return entrails[i]; }
+    Matrix(std::initializer_list<std::vector<Field>> matrix) : Matrix(std::vector<std::vector<Field>>(matrix)) {}
 
-    std::vector<Field> operator[](size_t i) const { return entrails[i]; }
+    Field *data() { return entrails.data(); }
+
+    const Field *data() const { return entrails.data(); }
+
+    MatrixSlice<Field> operator[](size_t i) { return {row(i), M}; }
+
+    MatrixSlice<const Field> operator[](size_t i) const { return {row(i), M}; }
 
     Matrix<N, M, Field> &operator+=(const Matrix<N, M, Field> &argument) {
-        for (size_t i = 0; i < N; i++) {
-            for (size_t k = 0; k < M; k++) {
-                entrails[i][k] += argument[i][k];
-            }
+        for (size_t i = 0; i < N * M; i++) {
+            entrails[i] += argument.entrails[i];
         }
         return *this;
     }
 
     Matrix<N, M, Field> &operator-=(const Matrix<N, M, Field> &argument) {
-        for (size_t i = 0; i < N; i++) {
-            for (size_t k = 0; k < M; k++) {
-                entrails[i][k] -= argument[i][k];
-            }
+        for (size_t i = 0; i < N * M; i++) {
+            entrails[i] -= argument.entrails[i];
         }
         return *this;
     }
 
     Matrix<N, M, Field> &operator*=(const Field &number) {
-        for (size_t i = 0; i < N; i++) {
-            for (size_t k = 0; k < M; k++) {
-                entrails[i][k] *= number;
-            }
+        for (size_t i = 0; i < N * M; i++) {
+            entrails[i] *= number;
         }
         return *this;
     }
 
     Matrix<N, M, Field> &operator*=(const Matrix<N, M, Field> &argument) {
         static_assert(N == M);
-        Matrix<N, N> newMatrix = (*this) * argument;
-        *this = newMatrix;
+        *this = (*this) * argument;
         return (*this);
     }
 
-    std::vector<Field> getRow(size_t i) const { return entrails[i]; }
+    MatrixSlice<const Field> getRow(size_t i) const { return {row(i), M}; }
 
-    std::vector<Field> getColumn(size_t i) const {
-        std::vector<Field> answer(N);
-        for (size_t k = 0; k < N; k++) {
-            answer[k] = entrails[k][i];
-        }
-        return answer;
-    }
+    MatrixSlice<const Field> getColumn(size_t i) const { return {entrails.data() + i, N, M}; }
 
     Matrix<M, N, Field> transposed() const {
-        //std::cerr << "trans";
-        Matrix<M, N, Field> newMatrix;
-        for (size_t i = 0; i < M; i++) {
-            for (size_t k = 0; k < N; k++) {
-                newMatrix[i][k] = entrails[k][i];
+        Matrix<M, N, Field> newMatrix(0ll);
+        for (size_t i = 0; i < N; i++) {
+            for (size_t k = 0; k < M; k++) {
+                newMatrix.entrails[k * N + i] = entrails[i * M + k];
             }
         }
         return newMatrix;
     }
 
-    std::pair<Matrix<N, M, Field>, Field> gauss();
+    std::pair<Matrix<N, M, Field>, Field> gauss(PivotPolicy policy = PivotPolicy::automatic);
 
     void invertGauss();
 
 
-    Field det() const {
+    Field det(EliminationStrategy strategy = EliminationStrategy::automatic) const {
         static_assert(N == M);
+        if constexpr (integral) {
+            if (strategy != EliminationStrategy::gauss) {
+                std::vector<BigInteger> integers;
+                BigInteger scale = integerEntries(integers);
+                BigInteger answer;
+                if (exactStrategy(strategy) == EliminationStrategy::multiModular)
+                    multiModular(integers, N, M, &answer, modularThreads);
+                else
+                    bareiss(integers.data(), N, M, answer);
+                return Field(answer) / Field(scale);
+            }
+        }
         //td::cerr << "det";
         Matrix newMatrix = *this;
         std::pair<Matrix<N, M, Field>, Field> res = newMatrix.gauss();
@@ -987,12 +1040,22 @@ public:
         return res.second;
     }
 
-    size_t rank() const {
+    size_t rank(EliminationStrategy strategy = EliminationStrategy::automatic) const {
+        if constexpr (integral) {
+            if (strategy != EliminationStrategy::gauss) {
+                std::vector<BigInteger> integers;
+                integerEntries(integers);
+                if (exactStrategy(strategy) == EliminationStrategy::multiModular)
+                    return multiModular(integers, N, M, nullptr, modularThreads);
+                BigInteger det;
+                return bareiss(integers.data(), N, M, det);
+            }
+        }
         //std::cerr << "rank";
         size_t answer = 0;
         Matrix newMatrix = *this;
         std::pair<Matrix<N, M, Field>, Field> res = newMatrix.gauss();
-        Matrix gaussMatrix = res.first;
+        const Matrix &gaussMatrix = res.first;
         for (size_t i = 0; i < N; i++) {
             for (size_t k = 0; k < M; k++) {
                 if (gaussMatrix[i][k] != Field(0)) {
@@ -1010,40 +1073,43 @@ public:
         //std::cerr << "trace";
         Field answer = Field(0);
         for (size_t i = 0; i < N; i++) {
-            answer += entrails[i][i];
+            answer += row(i)[i];
         }
         return answer;
     }
 
-    void concatenate() {
+    Matrix<N, 2 * M, Field> concatenated() const {
+        Matrix<N, 2 * M, Field> newMatrix(0ll);
         for (size_t i = 0; i < N; ++i) {
-            entrails[i].resize(M * 2, 0);
-            entrails[i][M + i] = Field(1);
+            std::copy(row(i), row(i) + M, newMatrix.row(i));
+            newMatrix.row(i)[M + i] = Field(1);
         }
+        return newMatrix;
     }
 
-    void invert() {
+    void invert(PivotPolicy policy = PivotPolicy::automatic) {
         static_assert(N == M);
-        concatenate();
+        Matrix<N, 2 * M, Field> augmented = concatenated();
 
-        gauss();
+        augmented.eliminate(N, policy);
         //invertGauss();
-        Matrix<N, M, Field> newMatrix;
         for (size_t i = 0; i < N; ++i) {
-            for (size_t k = 0; k < N; ++k) {
-                newMatrix[i][k] = entrails[i][k + N];
-            }
+            std::copy(augmented.row(i) + M, augmented.row(i) + 2 * M, row(i));
         }
-        *this = newMatrix;
     }
 
-    Matrix<N, M, Field> inverted() const {
+    Matrix<N, M, Field> inverted(PivotPolicy policy = PivotPolicy::automatic) const {
         //std::cerr << (*this);
         Matrix<N, M, Field> newMatrix = (*this);
-        newMatrix.invert();
+        newMatrix.invert(policy);
         return newMatrix;
     }
 
+    LUDecomposition<N, Field> lu(PivotPolicy policy = PivotPolicy::automatic) const {
+        static_assert(N == M);
+        return LUDecomposition<N, Field>(*this, policy);
+    }
+
     friend int main();
 };
 
@@ -1091,50 +1157,226 @@ Matrix<N, M, Field> operator-(const Matrix<N, M, Field> &argument1,
     return newMatrix;
 }
 
+template<typename Field>
+void addMul(Field &target, const Field &lhs, const Field &rhs) {
+    target += lhs * rhs;
+}
+
+void addMul(Rational &target, const Rational &lhs, const Rational &rhs) {
+    target.addMul(lhs, rhs);
+}
+
+template<typename Field>
+void subMul(Field &target, const Field &lhs, const Field &rhs) {
+    target -= lhs * rhs;
+}
+
+void subMul(Rational &target, const Rational &lhs, const Rational &rhs) {
+    target.subMul(lhs, rhs);
+}
+
+template<size_t Rows, size_t Depth, size_t Columns, typename Field>
+struct MultiplyTiles {
+    static constexpr size_t depth = std::max<size_t>(1, std::min<size_t>(Depth, 2048 / sizeof(Field)));
+    static constexpr size_t rows = std::max<size_t>(4, std::min<size_t>(Rows, 131072 / sizeof(Field) / depth) / 4 * 4);
+    static constexpr size_t columns = std::max<size_t>(8, std::min<size_t>(Columns, 262144 / sizeof(Field) / depth));
+};
+
+template<typename Tiles, typename Field>
+void multiplyTiled(const Field *lhs, const Field *rhs, Field *result, size_t rows, size_t depth, size_t columns) {
+    std::fill(result, result + rows * columns, Field(0));
+    for (size_t t0 = 0; t0 < depth; t0 += Tiles::depth) {
+        size_t depthEnd = std::min(depth, t0 + Tiles::depth);
+        for (size_t i0 = 0; i0 < rows; i0 += Tiles::rows) {
+            size_t rowEnd = std::min(rows, i0 + Tiles::rows);
+            for (size_t j0 = 0; j0 < columns; j0 += Tiles::columns) {
+                size_t columnEnd = std::min(columns, j0 + Tiles::columns);
+                for (size_t i = i0; i < rowEnd; i++) {
+                    for (size_t t = t0; t < depthEnd; t++) {
+                        const Field &factor = lhs[i * depth + t];
+                        if (factor == Field(0)) continue;
+                        for (size_t j = j0; j < columnEnd; j++) {
+                            addMul(result[i * columns + j], factor, rhs[t * columns + j]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename Tiles, typename Field>
+void multiplyKernel(const Field *lhs, const Field *rhs, Field *result, size_t rows, size_t depth, size_t columns) {
+    multiplyTiled<Tiles>(lhs, rhs, result, rows, depth, columns);
+}
+
+template<typename Tiles, size_t N>
+void multiplyKernel(const Residue<N> *lhs, const Residue<N> *rhs, Residue<N> *result, size_t rows, size_t depth,
+                    size_t columns) {
+    if constexpr (Residue<N>::packed)
+        Residue<N>::multiplyPacked(lhs, rhs, result, rows, depth, columns, Tiles::rows, Tiles::depth);
+    else
+        multiplyTiled<Tiles>(lhs, rhs, result, rows, depth, columns);
+}
+
+template<size_t Rows, size_t Depth, size_t Columns, typename Field>
+void multiplyBlocked(const Field *lhs, const Field *rhs, Field *result) {
+    multiplyKernel<MultiplyTiles<Rows, Depth, Columns, Field>>(lhs, rhs, result, Rows, Depth, Columns);
+}
+
+template<typename Field>
+void addVector(const std::vector<Field> &lhs, const std::vector<Field> &rhs, std::vector<Field> &result) {
+    for (size_t i = 0; i < result.size(); i++) {
+        result[i] = lhs[i] + rhs[i];
+    }
+}
+
+template<typename Field>
+void subtractVector(const std::vector<Field> &lhs, const std::vector<Field> &rhs, std::vector<Field> &result) {
+    for (size_t i = 0; i < result.size(); i++) {
+        result[i] = lhs[i] - rhs[i];
+    }
+}
+
+template<typename Tiles, typename Field>
+void multiplyStrassen(const Field *lhs, const Field *rhs, Field *result, size_t size, size_t threshold) {
+    if (size <= std::max<size_t>(threshold, 1)) {
+        multiplyKernel<Tiles>(lhs, rhs, result, size, size, size);
+        return;
+    }
+    size_t half = size / 2;
+    auto quadrant = [size, half](const Field *source, size_t row, size_t column) {
+        std::vector<Field> block(half * half);
+        for (size_t i = 0; i < half; i++) {
+            std::copy(source + (row + i) * size + column, source + (row + i) * size + column + half,
+                      block.begin() + i * half);
+        }
+        return block;
+    };
+    std::vector<Field> a11 = quadrant(lhs, 0, 0), a12 = quadrant(lhs, 0, half);
+    std::vector<Field> a21 = quadrant(lhs, half, 0), a22 = quadrant(lhs, half, half);
+    std::vector<Field> b11 = quadrant(rhs, 0, 0), b12 = quadrant(rhs, 0, half);
+    std::vector<Field> b21 = quadrant(rhs, half, 0), b22 = quadrant(rhs, half, half);
+    std::vector<Field> s1(half * half), s2(half * half), s3(half * half), s4(half * half);
+    std::vector<Field> t1(half * half), t2(half * half), t3(half * half), t4(half * half);
+    addVector(a21, a22, s1);
+    subtractVector(s1, a11, s2);
+    subtractVector(a11, a21, s3);
+    subtractVector(a12, s2, s4);
+    subtractVector(b12, b11, t1);
+    subtractVector(b22, t1, t2);
+    subtractVector(b22, b12, t3);
+    subtractVector(t2, b21, t4);
+    std::vector<std::vector<Field>> products(7, std::vector<Field>(half * half));
+    const std::vector<Field> *factors[7][2] = {{&a11, &b11}, {&a12, &b21}, {&s4,  &b22}, {&a22, &t4},
+                                               {&s1,  &t1},  {&s2,  &t2},  {&s3,  &t3}};
+    for (size_t i = 0; i < 7; i++) {
+        multiplyStrassen<Tiles>(factors[i][0]->data(), factors[i][1]->data(), products[i].data(), half, threshold);
+    }
+    for (size_t i = 0; i < half; i++) {
+        for (size_t j = 0; j < half; j++) {
+            size_t k = i * half + j;
+            Field u2 = products[0][k] + products[5][k];
+            Field u3 = u2 + products[6][k];
+            result[i * size + j] = products[0][k] + products[1][k];
+            result[i * size + half + j] = u2 + products[4][k] + products[2][k];
+            result[(half + i) * size + j] = u3 - products[3][k];
+            result[(half + i) * size + half + j] = u3 + products[4][k];
+        }
+    }
+    if (size % 2 == 0) return;
+    size_t last = size - 1;
+    for (size_t i = 0; i < last; i++) {
+        const Field &factor = lhs[i * size + last];
+        for (size_t j = 0; j < last; j++) {
+            addMul(result[i * size + j], factor, rhs[last * size + j]);
+        }
+    }
+    for (size_t i = 0; i < size; i++) {
+        for (size_t j = (i == last ? 0 : last); j < size; j++) {
+            Field sum = Field(0);
+            for (size_t t = 0; t < size; t++) {
+                addMul(sum, lhs[i * size + t], rhs[t * size + j]);
+            }
+            result[i * size + j] = sum;
+        }
+    }
+}
+
 template<size_t N1, size_t M, size_t N2, typename Field = Rational>
 Matrix<N1, N2, Field> operator*(const Matrix<N1, M, Field> &argument1,
                                 const Matrix<M, N2, Field> &argument2) {
     Matrix<N1, N2, Field> newMatrix(0ll);
-    for (size_t i = 0; i < N1; i++) {
-        for (size_t k = 0; k < N2; k++) {
-            for (size_t t = 0; t < M; t++) {
-                newMatrix[i][k] += argument1[i][t] * argument2[t][k];
-            }
+    if constexpr (N1 == M && M == N2) {
+        if (N1 > Matrix<N1, N1, Field>::strassenThreshold) {
+            multiplyStrassen<MultiplyTiles<N1, N1, N1, Field>>(argument1.data(), argument2.data(), newMatrix.data(), N1,
+                                                               Matrix<N1, N1, Field>::strassenThreshold);
+            return newMatrix;
         }
     }
+    multiplyBlocked<N1, M, N2>(argument1.data(), argument2.data(), newMatrix.data());
     return newMatrix;
 }
 
-template<typename Field = Rational>
-
-std::vector<Field> multiply(const std::vector<Field> &argument, const Field &number) {
-    std::vector<Field> copyArgument = argument;
-    for (size_t i = 0; i < argument.size(); i++) {
-        copyArgument[i] *= number;
+template<typename Field>
+Field dotProduct(const Field *argument1, const Field *argument2, size_t size) {
+    Field answer = Field(0);
+    for (size_t i = 0; i < size; i++) {
+        answer += argument1[i] * argument2[i];
     }
-    return copyArgument;
+    return answer;
+}
+
+template<size_t N>
+Residue<N> dotProduct(const Residue<N> *argument1, const Residue<N> *argument2, size_t size) {
+    return Residue<N>::dot(argument1, argument2, size);
 }
 
 template<typename Field = Rational>
-void deltaVector(std::vector<Field> &argument1,
-                 const std::vector<Field> &argument2) {
-    for (size_t i = 0; i < argument1.size(); i++) {
-        argument1[i] -= argument2[i];
+void deltaVector(Field *argument1, const Field *argument2, size_t size, const Field &number) {
+    if (number == Field(0)) return;
+    for (size_t i = 0; i < size; i++) {
+        subMul(argument1[i], argument2[i], number);
     }
 }
 
+template<size_t N>
+void deltaVector(Residue<N> *argument1, const Residue<N> *argument2, size_t size, const Residue<N> &number) {
+    if (number == Residue<N>(0)) return;
+    Residue<N>::subtractMultiple(argument1, argument2, size, number);
+}
+
 template<typename Field = Rational>
-void oneVector(std::vector<Field> &argument1, size_t first) {
-    for (size_t i = first + 1; i < argument1.size(); i++) {
-        argument1[i] /= argument1[first];
+void oneVector(Field *argument1, size_t size, size_t first) {
+    Field inverse = Field(1) / argument1[first];
+    for (size_t i = first + 1; i < size; i++) {
+        argument1[i] *= inverse;
     }
     argument1[first] = Field(1);
 }
 
+template<size_t N>
+void oneVector(Residue<N> *argument1, size_t size, size_t first) {
+    Residue<N>::scale(argument1 + first + 1, size - first - 1, Residue<N>(1) / argument1[first]);
+    argument1[first] = Residue<N>(1);
+}
+
+template<typename Field = Rational>
+void scaleVector(Field *argument1, size_t size, const Field &number) {
+    for (size_t i = 0; i < size; i++) {
+        argument1[i] *= number;
+    }
+}
+
+template<size_t N>
+void scaleVector(Residue<N> *argument1, size_t size, const Residue<N> &number) {
+    Residue<N>::scale(argument1, size, number);
+}
+
 template<size_t N, size_t M, typename Field = Rational>
 std::ostream &operator<<(std::ostream &Ostream, const Matrix<N, M, Field> &input) {
     for (size_t i = 0; i < N; ++i) {
-        for (size_t k = 0; k < N; ++k) {
+        for (size_t k = 0; k < M; ++k) {
             Ostream << double(input[i][k]) << " ";
         }
         Ostream << std::endl;
@@ -1143,40 +1385,95 @@ std::ostream &operator<<(std::ostream &Ostream, const Matrix<N, M, Field> &input
 }
 
 template<size_t N, size_t M, typename Field>
-std::pair<Matrix<N, M, Field>, Field> Matrix<N, M, Field>::gauss() {
+Field Matrix<N, M, Field>::eliminate(size_t columns, PivotPolicy policy) {
+    policy = resolvePivotPolicy<Field>(policy);
     Field det = Field(1);
-    for (size_t i = 0; i < std::min(N, M); i++) {
-        size_t nowIndex = i;
-        while (nowIndex < N && entrails[nowIndex][i] == Field(0)) {
-            nowIndex++;
-        }
-        if (nowIndex != N) {
-            if (nowIndex != i) {
-                det = -det;
-                std::swap(entrails[i], entrails[nowIndex]);
+    WorkerPool *pool = N >= parallelGaussThreshold && gaussThreads > 1 ? &WorkerPool::shared(gaussThreads) : nullptr;
+    std::vector<std::pair<size_t, size_t>> columnSwaps;
+    // Columns without a pivot are skipped, so the pivot rows stay packed at the top and the result is in reduced
+    // row echelon form. Complete pivoting only looks at the first columns, the ones det refers to.
+    size_t rank = 0;
+    bool singular = false;
+    for (size_t i = 0; i < M && rank < N; i++) {
+        size_t nowIndex = N;
+        size_t nowColumn = i;
+        size_t lastColumn = policy == PivotPolicy::complete && i < columns ? columns : i + 1;
+        for (size_t column = i; column < lastColumn; column++) {
+            for (size_t k = rank; k < N; k++) {
+                const Field &candidate = row(k)[column];
+                if (candidate == Field(0)) continue;
+                if (nowIndex == N || betterPivot(candidate, row(nowIndex)[nowColumn], policy)) {
+                    nowIndex = k;
+                    nowColumn = column;
+                }
+                if (policy == PivotPolicy::firstNonZero) break;
             }
-            det *= entrails[i][i];
-            oneVector(entrails[i], i);
+        }
+        if (nowIndex == N) {
+            det = Field(0);
+            singular = true;
+            continue;
+        }
+        if (nowColumn != i) {
+            det = -det;
+            columnSwaps.emplace_back(i, nowColumn);
             for (size_t k = 0; k < N; k++) {
-                if (k != i) {
-                    deltaVector(entrails[k], multiply(entrails[i], entrails[k][i]));
-                }
+                std::swap(row(k)[i], row(k)[nowColumn]);
             }
         }
+        if (nowIndex != rank) {
+            det = -det;
+            std::swap_ranges(row(rank), row(rank) + M, row(nowIndex));
+        }
+        det *= row(rank)[i];
+        oneVector(row(rank), M, i);
+        size_t blocks = pool ? std::min(N, 4 * pool->size()) : 1;
+        auto update = [this, i, rank, blocks](size_t block) {
+            for (size_t k = block * N / blocks; k < (block + 1) * N / blocks; k++) {
+                if (k != rank) {
+                    Field factor = row(k)[i];
+                    deltaVector(row(k), row(rank), M, factor);
+                }
+            }
+        };
+        if (pool)
+            pool->run(blocks, update);
+        else
+            update(0);
+        rank++;
 
         //std::cout << (*this) << std::endl << std::endl;
 
     }
-    size_t nowIndex = N;
-    if (M > N) {
-        while (entrails[N - 1][nowIndex] == Field(0))nowIndex++;
-        if (nowIndex != M) {
-            oneVector(entrails[N - 1], nowIndex);
-            for (size_t k = 0; k < N - 1; k++) {
-                deltaVector(entrails[k], multiply(entrails[N - 1], entrails[k][nowIndex]));
-            }
+    if (columnSwaps.empty()) return det;
+    // Undo the column exchanges and bring the rows back into echelon order.
+    for (size_t s = columnSwaps.size(); s > 0; s--) {
+        for (size_t k = 0; k < N; k++) {
+            std::swap(row(k)[columnSwaps[s - 1].first], row(k)[columnSwaps[s - 1].second]);
         }
     }
+    if (singular) {
+        // On a singular block the pivot columns complete pivoting settled on need not be the leading ones, so
+        // one more pass without column exchanges is needed to reach the reduced row echelon form.
+        eliminate(columns, PivotPolicy::firstNonZero);
+        return det;
+    }
+    std::vector<size_t> leading(N), order(N);
+    for (size_t k = 0; k < N; k++) {
+        leading[k] = std::find_if(row(k), row(k) + M, [](const Field &value) { return value != Field(0); }) - row(k);
+        order[k] = k;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return leading[lhs] < leading[rhs]; });
+    Storage sorted = entrails;
+    for (size_t k = 0; k < N; k++) {
+        std::copy(sorted.data() + order[k] * M, sorted.data() + (order[k] + 1) * M, row(k));
+    }
+    return det;
+}
+
+template<size_t N, size_t M, typename Field>
+std::pair<Matrix<N, M, Field>, Field> Matrix<N, M, Field>::gauss(PivotPolicy policy) {
+    Field det = eliminate(std::min(N, M), policy);
     //std::cout << (*this) << std::endl << std::endl;
     return {*this, det};
 }
@@ -1185,8 +1482,118 @@ template<size_t N, size_t M, typename Field>
 void Matrix<N, M, Field>::invertGauss() {
     for (size_t i = N; i > 0; --i) {
         for (size_t k = i - 1; k > 0; --k) {
-            entrails[k - 1][i - 1] -= entrails[i - 1][i - 1];
+            row(k - 1)[i - 1] -= row(i - 1)[i - 1];
             //deltaVector(entrails[k-1], multiply(entrails[i-1], entrails[k-1][i-1]));
         }
     }
 }
+
+// PA = LU with L unit lower triangular and U in row echelon form. Columns without a pivot are skipped, so rank()
+// is exact for singular matrices as well; solve() and inverse() need a nonsingular matrix.
+template<size_t N, typename Field>
+class LUDecomposition {
+private:
+    Matrix<N, N, Field> lowerFactor;
+    Matrix<N, N, Field> upperFactor;
+    std::array<size_t, N> permutation;
+    std::vector<Field> pivotInverses;
+    size_t pivots = 0;
+    Field determinant = Field(1);
+
+    void substitute(Field *rows, size_t width) const {
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = 0; j < i; j++) {
+                deltaVector(rows + i * width, rows + j * width, width, lowerFactor[i][j]);
+            }
+        }
+        for (size_t i = N; i > 0; i--) {
+            for (size_t j = i; j < N; j++) {
+                deltaVector(rows + (i - 1) * width, rows + j * width, width, upperFactor[i - 1][j]);
+            }
+            scaleVector(rows + (i - 1) * width, width, pivotInverses[i - 1]);
+        }
+    }
+
+public:
+    // A singular matrix still factors, with rank() below N and det() zero. Its missing pivots have zero inverses,
+    // so solve() and inverse() then behave like invert(): they return without an error, but the result means
+    // nothing.
+    explicit LUDecomposition(const Matrix<N, N, Field> &matrix, PivotPolicy policy = PivotPolicy::automatic)
+            : upperFactor(matrix), pivotInverses(N, Field(0)) {
+        policy = resolvePivotPolicy<Field>(policy);
+        for (size_t i = 0; i < N; i++) {
+            permutation[i] = i;
+        }
+        Field *upper = upperFactor.data();
+        Field *lower = lowerFactor.data();
+        for (size_t column = 0; column < N && pivots < N; column++) {
+            size_t nowIndex = N;
+            for (size_t k = pivots; k < N; k++) {
+                const Field &candidate = upper[k * N + column];
+                if (candidate == Field(0)) continue;
+                if (nowIndex == N || betterPivot(candidate, upper[nowIndex * N + column], policy)) nowIndex = k;
+                if (policy == PivotPolicy::firstNonZero) break;
+            }
+            if (nowIndex == N) continue;
+            if (nowIndex != pivots) {
+                determinant = -determinant;
+                std::swap(permutation[pivots], permutation[nowIndex]);
+                std::swap_ranges(upper + pivots * N, upper + (pivots + 1) * N, upper + nowIndex * N);
+                std::swap_ranges(lower + pivots * N, lower + pivots * N + pivots, lower + nowIndex * N);
+            }
+            const Field &pivot = upper[pivots * N + column];
+            determinant *= pivot;
+            pivotInverses[pivots] = Field(1) / pivot;
+            for (size_t k = pivots + 1; k < N; k++) {
+                Field factor = upper[k * N + column] * pivotInverses[pivots];
+                lower[k * N + pivots] = factor;
+                deltaVector(upper + k * N + column + 1, upper + pivots * N + column + 1, N - column - 1, factor);
+                upper[k * N + column] = Field(0);
+            }
+            pivots++;
+        }
+        if (pivots != N) determinant = Field(0);
+    }
+
+    const Matrix<N, N, Field> &lower() const { return lowerFactor; }
+
+    const Matrix<N, N, Field> &upper() const { return upperFactor; }
+
+    // Row i of PA is row permutation()[i] of A.
+    const std::array<size_t, N> &rowPermutation() const { return permutation; }
+
+    size_t rank() const { return pivots; }
+
+    Field det() const { return determinant; }
+
+    std::vector<Field> solve(const std::vector<Field> &rhs) const {
+        std::vector<Field> answer(N);
+        for (size_t i = 0; i < N; i++) {
+            answer[i] = rhs[permutation[i]] - dotProduct(lowerFactor[i].data(), answer.data(), i);
+        }
+        for (size_t i = N; i > 0; i--) {
+            Field rest = dotProduct(upperFactor[i - 1].data() + i, answer.data() + i, N - i);
+            answer[i - 1] = (answer[i - 1] - rest) * pivotInverses[i - 1];
+        }
+        return answer;
+    }
+
+    template<size_t K>
+    Matrix<N, K, Field> solve(const Matrix<N, K, Field> &rhs) const {
+        Matrix<N, K, Field> answer(0ll);
+        for (size_t i = 0; i < N; i++) {
+            std::copy(rhs.data() + permutation[i] * K, rhs.data() + (permutation[i] + 1) * K, answer.data() + i * K);
+        }
+        substitute(answer.data(), K);
+        return answer;
+    }
+
+    Matrix<N, N, Field> inverse() const {
+        Matrix<N, N, Field> answer(0ll);
+        for (size_t i = 0; i < N; i++) {
+            answer[i][permutation[i]] = Field(1);
+        }
+        substitute(answer.data(), N);
+        return answer;
+    }
+};